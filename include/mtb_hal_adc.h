@@ -57,6 +57,15 @@
  * \snippet hal_adc.c snippet_mtb_hal_adc_simple_init
  * \subsection subsection_adc_snippet_2 Snippet 2: Single-channel ADC initialization set to start a fresh conversion and read the latest result.
  * \snippet hal_adc.c snippet_mtb_hal_read_latest
+ *
+ * \section subsection_adc_stream Streaming Acquisition
+ * \ref mtb_hal_adc_stream_start captures every scan of the enabled channel group into a ring
+ * buffer without CPU involvement. The group is started by its hardware trigger (for example a
+ * TCPWM counter) and the group done trigger of the last channel requests one DMA X loop, which
+ * copies the results of all channels of the scan. The ring holds two blocks of scans, each block
+ * interleaved by channel. The application is notified from the DMA interrupt when a block has
+ * been filled, together with a timer timestamp taken at completion, and processes it while the
+ * other block is being filled.
  */
 //" *RESUME-FORMATTING*"
 #pragma once
@@ -85,6 +94,9 @@ extern "C" {
 /** Unsupported operation */
 #define MTB_HAL_ADC_RSLT_ERR_NOT_SUPPORTED                      \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_ADC, 2))
+/** Bad argument */
+#define MTB_HAL_ADC_RSLT_ERR_BAD_ARGUMENT                       \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_ADC, 3))
 /**
  * \}
  */
@@ -166,6 +178,78 @@ cy_rslt_t mtb_hal_adc_read_multiple(mtb_hal_adc_channel_t** channels, uint32_t n
  */
 cy_rslt_t mtb_hal_adc_start_convert(mtb_hal_adc_t* obj);
 
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER)
+/** Streaming acquisition events */
+typedef enum
+{
+    MTB_HAL_ADC_STREAM_EVENT_HALF  = 1 << 0, //!< The first block of the ring has been filled
+    MTB_HAL_ADC_STREAM_EVENT_FULL  = 1 << 1, //!< The second block of the ring has been filled
+    MTB_HAL_ADC_STREAM_EVENT_ERROR = 1 << 2  //!< The DMA reported an error, streaming stopped
+} mtb_hal_adc_stream_event_t;
+
+/** Handler for streaming acquisition events
+ *
+ * @param[in] callback_arg  Argument provided in \ref mtb_hal_adc_stream_config_t
+ * @param[in] event         The event
+ * @param[in] block         First result of the filled block, NULL for
+ *                          \ref MTB_HAL_ADC_STREAM_EVENT_ERROR
+ * @param[in] timestamp     Timer value read when the block completed
+ */
+typedef void (* mtb_hal_adc_stream_callback_t)(void* callback_arg,
+                                               mtb_hal_adc_stream_event_t event,
+                                               const uint16_t* block, uint32_t timestamp);
+
+/** Streaming acquisition configuration, see \ref mtb_hal_adc_stream_start */
+typedef struct
+{
+    //! Ring storage for 2 * scans_per_block * \ref mtb_hal_adc_stream_get_channel_count results.
+    //! Must be aligned and sized to whole D-cache lines on devices with a D-cache.
+    uint16_t*                           buffer;
+    //! Number of scans in each of the two blocks
+    uint32_t                            scans_per_block;
+    //! Running timer used to timestamp blocks, may be NULL
+    const mtb_hal_timer_t*              timer;
+    //! Called from the DMA interrupt when a block has been filled
+    mtb_hal_adc_stream_callback_t       callback;
+    //! Generic argument that will be provided to the callback when called
+    void*                               callback_arg;
+} mtb_hal_adc_stream_config_t;
+
+/** Returns the number of results produced by one scan of the channel group, i.e. the channels
+ * from the first to the last enabled channel.
+ *
+ * @param[in] obj          The ADC object
+ * @return Number of results per scan
+ */
+uint32_t mtb_hal_adc_stream_get_channel_count(const mtb_hal_adc_t* obj);
+
+/** Start streaming acquisition, see \ref subsection_adc_stream.
+ *
+ * The DMA channel must be set up by the configurator as a 2D transfer of 16-bit elements: the X
+ * loop reads the RESULT register of every channel of the group (source increment equal to the
+ * channel register stride) and is requested by the group done trigger of the last channel.
+ * \ref mtb_hal_dma_process_interrupt must be invoked from the DMA interrupt handler. With an
+ * X loop interrupt both \ref MTB_HAL_ADC_STREAM_EVENT_HALF and
+ * \ref MTB_HAL_ADC_STREAM_EVENT_FULL are reported as the blocks complete; with a descriptor
+ * interrupt both are reported together at the end of the ring.
+ * \ref mtb_hal_adc_read_u16 must not be used while streaming.
+ *
+ * @param[in] obj          The ADC object
+ * @param[in] dma          The DMA object moving the results
+ * @param[in] config       The streaming configuration
+ * @return The status of the stream_start request
+ */
+cy_rslt_t mtb_hal_adc_stream_start(mtb_hal_adc_t* obj, mtb_hal_dma_t* dma,
+                                   const mtb_hal_adc_stream_config_t* config);
+
+/** Stop streaming acquisition started by \ref mtb_hal_adc_stream_start
+ *
+ * @param[in] obj          The ADC object
+ * @return The status of the stream_stop request
+ */
+cy_rslt_t mtb_hal_adc_stream_stop(mtb_hal_adc_t* obj);
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER) */
+
 #if defined(__cplusplus)
 }
 #endif
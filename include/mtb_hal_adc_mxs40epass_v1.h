@@ -76,6 +76,9 @@ __STATIC_INLINE cy_rslt_t _mtb_hal_adc_setup(mtb_hal_adc_t* obj,
 
     obj->continuous_scanning = config->config->channelConfig[0]->triggerSelection ==
                                CY_SAR2_TRIGGER_CONTINUOUS ? true : false;
+    #if defined(MTB_HAL_DRIVER_AVAILABLE_DMA) && defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+    memset(&(obj->stream), 0, sizeof(obj->stream));
+    #endif
 
     /* Setup channels */
     for (uint32_t channel_idx = 0; channel_idx < config->num_channels; channel_idx++)
@@ -76,6 +76,9 @@ extern "C" {
 /** Unsupported operation. */
 #define MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED               \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_CLOCK, 1))
+/** The frequency cannot be set without violating the tolerance of another user of the clock. */
+#define MTB_HAL_CLOCK_RSLT_ERR_CONFLICT               \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_CLOCK, 2))
 
 /**
  * \}
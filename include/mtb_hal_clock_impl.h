@@ -35,6 +35,18 @@
  * The clock driver is a single interface designed to allow reading and configuring
  * any clock in the system.
  *
+ * \section subsection_clock_shared Shared Peripheral Dividers
+ * Several peripherals can be clocked from one peripheral divider. Each peripheral gets its own
+ * \ref mtb_hal_clock_shared_t, attached to a common \ref mtb_hal_clock_shared_div_t with
+ * \ref mtb_hal_clock_shared_attach, and is given a \ref mtb_hal_clock_t that uses
+ * \ref mtb_hal_clock_shared_interface. The drivers use that clock object unchanged.
+ *
+ * Every frequency a peripheral requests is remembered together with its tolerance. A new
+ * request is planned against the tolerance windows of all other peripherals on the divider:
+ * the divider is set to the value closest to the request that keeps every peripheral within
+ * its window, even if that is not the divider the request alone would have chosen. If no such
+ * value exists, the divider is left unchanged and \ref MTB_HAL_CLOCK_RSLT_ERR_CONFLICT is
+ * returned. The divider is disabled only once no peripheral needs it.
  */
 
 #pragma once
@@ -63,12 +75,24 @@ extern "C" {
 /*******************************************************************************
 *                           Structs
 *******************************************************************************/
+/** Peripheral divider setting computed by \ref mtb_hal_clock_calc_peri_div */
+typedef struct
+{
+    uint32_t divider;   //!< Divider value, fixed-point with 5 fraction bits
+    uint32_t frequency; //!< Output frequency achieved with the divider
+    int32_t  error_ppm; //!< Desired minus achieved frequency, in PPM of the desired frequency
+} mtb_hal_clock_peri_div_result_t;
+
 /** Default global interface for peripheral clocks */
 extern const mtb_hal_clock_interface_t mtb_hal_clock_peri_interface;
 
 /** Default global interface for high freqeuncy clocks */
 extern const mtb_hal_clock_interface_t mtb_hal_clock_hf_interface;
 
+/** Interface for peripheral dividers shared by several peripherals. The clock reference is a
+ * \ref mtb_hal_clock_shared_t */
+extern const mtb_hal_clock_interface_t mtb_hal_clock_shared_interface;
+
 /*******************************************************************************
 *                          Function Pointers
 *******************************************************************************/
@@ -88,6 +112,8 @@ extern const mtb_hal_clock_interface_t mtb_hal_clock_hf_interface;
 uint32_t mtb_hal_clock_get_peri_clock_freq(const void* clk);
 
 /** Update the operating frequency of the peripheral clock
+ *
+ * The divider is chosen with \ref mtb_hal_clock_calc_peri_div.
  *
  * @param[in] clk               Clock reference. For peri clock, expected clock
  *                              object is of type mtb_hal_peri_div_t*
@@ -100,6 +126,23 @@ uint32_t mtb_hal_clock_get_peri_clock_freq(const void* clk);
 cy_rslt_t mtb_hal_clock_set_peri_clock_freq(const void* clk, uint32_t frequency,
                                             uint32_t tolerance_ppm);
 
+/** Calculate the peripheral divider setting whose output is closest to a frequency
+ *
+ * Integer dividers are searched for the closest integer value; 16.5 and 24.5 dividers are also
+ * searched for the closest fraction. The result is computed in closed form with integer
+ * arithmetic only, so it is cheap on cores without a floating-point unit. The hardware is not
+ * modified.
+ *
+ * @param[in]  clk              Clock reference. For peri clock, expected clock
+ *                              object is of type mtb_hal_peri_div_t*
+ * @param[in]  frequency        Desired clock frequency
+ * @param[out] result           The divider, the frequency it achieves and the error
+ *
+ * @return The result of the calculation
+ */
+cy_rslt_t mtb_hal_clock_calc_peri_div(const void* clk, uint32_t frequency,
+                                      mtb_hal_clock_peri_div_result_t* result);
+
 /** Enable/Disable the peripheral clock
  *
  * @param[in] clk               Clock reference. For peri clock, expected clock
@@ -128,7 +171,13 @@ uint32_t mtb_hal_clock_get_peri_src_clock_freq(const void* clk);
 uint32_t mtb_hal_clock_get_hf_clock_freq(const void* clk);
 
 /** Update the operating frequency of the high frequency clock
- * @note currently this operation is not supported and will always return an error
+ *
+ * The CLK_HF divider is changed; its source path (FLL, PLL or oscillator) is left running, so
+ * the change takes effect within microseconds and the frequencies reachable are the source
+ * divided by 1, 2, 4 or 8. Callbacks registered with \ref mtb_hal_clock_register_hf_callback are
+ * run around the change and can refuse it, in which case
+ * \ref MTB_HAL_CLOCK_RSLT_ERR_CONFLICT is returned. Flash wait states are adjusted when
+ * CLK_HF0 changes, and SystemCoreClock is updated.
  *
  * @param[in] clk               Clock reference. For HF clock, expected clock
  *                              object is of type mtb_hal_hf_clock_t*
@@ -151,6 +200,138 @@ cy_rslt_t mtb_hal_clock_set_hf_clock_freq(const void* clk, uint32_t frequency,
  */
 cy_rslt_t mtb_hal_clock_set_hf_clock_enabled(const void* clk, bool enable);
 
+/** Register a callback to be run around every CLK_HF frequency change
+ *
+ * Callbacks run in registration order from within a critical section. If one refuses the
+ * change in \ref MTB_HAL_CLOCK_HF_CHECK_READY, only the callbacks that already accepted it are
+ * run for \ref MTB_HAL_CLOCK_HF_CHECK_FAIL.
+ * Registering a registration again updates its callback and argument and moves it to the end.
+ *
+ * @param[out] obj              The registration. Must stay valid until unregistered.
+ * @param[in]  callback         The callback
+ * @param[in]  callback_arg     Argument passed to the callback
+ */
+void mtb_hal_clock_register_hf_callback(mtb_hal_clock_hf_callback_data_t* obj,
+                                        mtb_hal_clock_hf_callback_t callback, void* callback_arg);
+
+/** Remove a callback registered with \ref mtb_hal_clock_register_hf_callback
+ *
+ * @param[in] obj               The registration
+ */
+void mtb_hal_clock_unregister_hf_callback(mtb_hal_clock_hf_callback_data_t* obj);
+
+/** Keep a peripheral clock at its current frequency across CLK_HF changes
+ *
+ * Whenever the CLK_HF feeding the peripheral divider changes, the divider is recomputed so that
+ * its output stays where it was. The divider is reprogrammed before the change when CLK_HF
+ * speeds up and after it when CLK_HF slows down, so the peripheral never runs faster than
+ * intended in between. A CLK_HF change that would move the output further than `tolerance_ppm`
+ * is refused. This keeps the UART, SPI, I2C, PWM and timer drivers at their configured rates
+ * without reconfiguring them. On a shared divider the new divider must also suit the other
+ * peripherals attached to it. Frequencies set later through the clock's interface are held
+ * only after calling this function again with the same hold.
+ *
+ * @param[out] hold             The hold. Must stay valid until released.
+ * @param[in]  clock            A clock using \ref mtb_hal_clock_peri_interface or
+ *                              \ref mtb_hal_clock_shared_interface
+ * @param[in]  tolerance_ppm    The allowed deviation from the current frequency
+ *
+ * @return The result of the request
+ */
+cy_rslt_t mtb_hal_clock_hold_peri_freq(mtb_hal_clock_peri_hold_t* hold,
+                                       const mtb_hal_clock_t* clock, uint32_t tolerance_ppm);
+
+/** Stop holding a peripheral clock frequency
+ *
+ * @param[in] hold              The hold passed to \ref mtb_hal_clock_hold_peri_freq
+ */
+void mtb_hal_clock_release_peri_freq(mtb_hal_clock_peri_hold_t* hold);
+
+/** Attach a peripheral to a shared peripheral divider
+ *
+ * The peripheral is considered to need the divider running until it disables it through
+ * \ref mtb_hal_clock_shared_interface or is detached.
+ *
+ * @param[out] consumer         The record for the peripheral. Must stay valid until detached.
+ * @param[in]  group            The shared divider. Its `divider` member must be set and its
+ *                              `consumers` member zeroed before the first attach.
+ * @param[in]  frequency        The frequency the peripheral needs now, or 0 if it has no
+ *                              requirement until it requests one through the clock interface
+ * @param[in]  tolerance_ppm    The allowed tolerance in PPM on `frequency`
+ *
+ * @return The result of the request. If `frequency` cannot be met alongside the other
+ * peripherals, the peripheral is not attached.
+ */
+cy_rslt_t mtb_hal_clock_shared_attach(mtb_hal_clock_shared_t* consumer,
+                                      mtb_hal_clock_shared_div_t* group, uint32_t frequency,
+                                      uint32_t tolerance_ppm);
+
+/** Detach a peripheral from its shared peripheral divider
+ *
+ * The divider is disabled if no remaining peripheral has it enabled.
+ *
+ * @param[in] consumer          The record passed to \ref mtb_hal_clock_shared_attach
+ */
+void mtb_hal_clock_shared_detach(mtb_hal_clock_shared_t* consumer);
+
+/** Gets the frequency of a shared peripheral divider. See \ref mtb_hal_clock_shared_interface
+ *
+ * @param[in] clk               Clock reference of type mtb_hal_clock_shared_t*
+ *
+ * @return The frequency the divider is currently running at
+ */
+uint32_t mtb_hal_clock_get_shared_clock_freq(const void* clk);
+
+/** Request a frequency from a shared peripheral divider. See \ref mtb_hal_clock_shared_interface
+ *
+ * @param[in] clk               Clock reference of type mtb_hal_clock_shared_t*
+ * @param[in] frequency         Desired clock frequency
+ * @param[in] tolerance_ppm     The allowed tolerance in the units of PPM from the desired frequency
+ *
+ * @return The result of the request. \ref MTB_HAL_CLOCK_RSLT_ERR_CONFLICT if the request cannot
+ * be met without moving another peripheral outside of its tolerance.
+ */
+cy_rslt_t mtb_hal_clock_set_shared_clock_freq(const void* clk, uint32_t frequency,
+                                              uint32_t tolerance_ppm);
+
+/** Enable/Disable a peripheral's use of a shared peripheral divider
+ *
+ * @param[in] clk               Clock reference of type mtb_hal_clock_shared_t*
+ * @param[in] enable            true to enable. false to disable once no other peripheral uses it
+ *
+ * @return The result of the enable/disable request
+ */
+cy_rslt_t mtb_hal_clock_set_shared_clock_enabled(const void* clk, bool enable);
+
+/** \cond INTERNAL */
+
+/** Number of fraction bits in a fixed-point peripheral divider value */
+#define _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS   (5U)
+
+/** Finds the peripheral divider value whose output is closest to the desired frequency.
+ *
+ * Only integer arithmetic is used. The divider is limited to the range of the divider type;
+ * integer dividers never get a fraction.
+ *
+ * @param[in]  source_freq      Frequency feeding the divider
+ * @param[in]  div_type         Divider type
+ * @param[in]  frequency        Desired output frequency
+ * @param[out] divider          The divider value, fixed-point with
+ *                              \ref _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS fraction bits
+ * @return The output frequency achieved with the divider
+ */
+uint32_t _mtb_hal_clock_calc_peri_div(uint32_t source_freq, cy_en_divider_types_t div_type,
+                                      uint32_t frequency, uint32_t* divider);
+
+/** Programs a peripheral divider with a value computed by \ref _mtb_hal_clock_calc_peri_div
+ *
+ * @param[in] clk               Clock reference of type mtb_hal_peri_div_t*
+ * @param[in] divider           The fixed-point divider value
+ */
+void _mtb_hal_clock_set_peri_div(const void* clk, uint32_t divider);
+
+/** \endcond */
+
 #if defined(__cplusplus)
 }
 #endif /* defined(__cplusplus) */
@@ -44,6 +44,9 @@
  * * Configurable source and destination address
  * * Configurable data transfer length
  * * Event completion notification
+ * * Scatter-gather descriptor chains
+ * * Memory copy and fill with automatic fallback to the CPU
+ * * Channel pool shared between drivers, allocated per transfer
  *
  * \section Usage Flow
  * The operational flow of the driver is listed below. This shows the basic order in which each of
@@ -53,7 +56,7 @@
  * -# Enable the DMA channel and the DMA HW
  * -# Configure and Enable the DMA interrupt
  * -# Configure: \ref mtb_hal_dma_set_src_addr, \ref mtb_hal_dma_set_dst_addr, \ref
- * mtb_hal_dma_set_length
+ * mtb_hal_dma_set_length, or all three at once with \ref mtb_hal_dma_set_transfer
  * -# Enable the event and callback: \ref mtb_hal_dma_register_callback, \ref
  * mtb_hal_dma_enable_event
  *
@@ -104,6 +107,36 @@
  * Refer to \ref DCACHE_Management for more information.
  *
  * \snippet hal_dma.c snippet_mtb_hal_dma_with_dcache
+ *
+ * \section section_dma_mem Memory Transfers
+ * \ref mtb_hal_dma_mem_copy, \ref mtb_hal_dma_mem_fill and \ref mtb_hal_dma_mem_copy_2d move
+ * memory with a channel allocated from the \ref section_dma_pool for the duration of the
+ * transfer, preferably a DMAC channel, running at \ref MTB_HAL_DMA_PRIORITY_LOWEST. The D-cache
+ * is cleaned over the source and invalidated over the destination by the driver, so only the
+ * alignment rules of \ref subsection_dma_snippet_3 apply.
+ *
+ * Transfers shorter than a threshold, or started while no pooled channel is free, are done
+ * by the CPU before the function returns. The threshold is the size above which the DMA
+ * finishes first, which \ref mtb_hal_dma_mem_calibrate measures at startup; until then
+ * \ref MTB_HAL_DMA_MEM_THRESHOLD_DEFAULT is used. Completion is reported to the optional
+ * callback and by \ref mtb_hal_dma_mem_get_status, which can be polled.
+ *
+ * \section section_dma_pool Channel Pool
+ * Channels that are only needed for the duration of a transfer can be shared through a pool.
+ * The channels are set up as usual and lent to the pool with \ref mtb_hal_dma_pool_add_channel.
+ * A user then takes a channel with \ref mtb_hal_dma_pool_alloc when it starts a transfer,
+ * programs it with \ref mtb_hal_dma_set_transfer and hands it back with
+ * \ref mtb_hal_dma_pool_free when the transfer completes, which may be done from the completion
+ * callback. The request names the preferred DMA type, so that the DMAC channels can be kept for
+ * high-bandwidth streams, and the arbitration priority the channel runs at while allocated.
+ * \ref mtb_hal_dma_pool_get_stats reports how busy the pool is and how often a request could not
+ * be served by its preferred type. A free channel is taken back with
+ * \ref mtb_hal_dma_pool_remove_channel.
+ *
+ * A channel lent to the pool must not be used outside of an allocation, nor lent to the pool
+ * while another user drives it: the memory transfers of \ref section_dma_mem run on free pool
+ * channels at any time. They put the channel's descriptor back when they are done; channels with
+ * a scatter-gather chain attached are not used for them.
  */
 
 #pragma once
@@ -140,6 +173,15 @@ extern "C" {
 /** Requested operation is not supported */
 #define MTB_HAL_DMA_RSLT_ERR_NOT_SUPPORTED                 \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_DMA, 4))
+/** Memory transfer still in progress */
+#define MTB_HAL_DMA_RSLT_WARN_IN_PROGRESS                  \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_WARNING, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_DMA, 5))
+/** Memory transfer stopped by a bus or descriptor error */
+#define MTB_HAL_DMA_RSLT_ERR_TRANSFER                      \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_DMA, 6))
+/** No pooled channel is free */
+#define MTB_HAL_DMA_RSLT_WARN_NO_CHANNEL                   \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_WARNING, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_DMA, 7))
 
 /**
  * \}
@@ -169,9 +211,43 @@ typedef enum
                                                  the DMA transfer */
 } mtb_hal_dma_event_t;
 
+/** One entry of a scatter-gather list, see \ref mtb_hal_dma_set_scatter_gather */
+typedef struct
+{
+    uint32_t src_addr; //!< Source address of the fragment
+    uint32_t dst_addr; //!< Destination address of the fragment
+    uint32_t length;   //!< Fragment length, in elements
+} mtb_hal_dma_sg_entry_t;
+
 /** Event handler for DMA interrupts */
 typedef void (* mtb_hal_dma_event_callback_t)(void* callback_arg, mtb_hal_dma_event_t event);
 
+/** Size in bytes below which memory transfers are done by the CPU until
+ * \ref mtb_hal_dma_mem_calibrate is called */
+#define MTB_HAL_DMA_MEM_THRESHOLD_DEFAULT       (256u)
+
+/** Completion handler of a memory transfer, see \ref section_dma_mem
+ *
+ * @param[in] callback_arg  The argument given when the transfer was started
+ * @param[in] status        CY_RSLT_SUCCESS, or the reason the transfer stopped
+ */
+typedef void (* mtb_hal_dma_mem_callback_t)(void* callback_arg, cy_rslt_t status);
+
+/** Lowest arbitration priority of a channel. 0 is the highest. */
+#define MTB_HAL_DMA_PRIORITY_LOWEST             (3u)
+
+/** Usage of the channel pool, see \ref section_dma_pool. Arrays are indexed by
+ * \ref mtb_hal_dma_type_t. */
+typedef struct
+{
+    uint32_t channels[2];   //!< Channels lent to the pool
+    uint32_t in_use[2];     //!< Channels allocated now
+    uint32_t in_use_max[2]; //!< Most channels allocated at the same time
+    uint32_t allocations;   //!< Requests that got a channel
+    uint32_t fallbacks;     //!< Requests served by the other DMA type than the preferred one
+    uint32_t failures;      //!< Requests that found no free channel
+} mtb_hal_dma_pool_stats_t;
+
 /**
  * Sets up a HAL instance to use the specified hardware resource. This hardware
  * resource must have already been configured via the PDL.
@@ -213,13 +289,92 @@ cy_rslt_t mtb_hal_dma_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr);
 /** Set the length for the DMA transfer
  *
  * @param[in] obj      The DMA object
- * @param[in] length   The transfer length, in bytes
+ * @param[in] length   The transfer length, in elements of the configured data size
  * @return The status of the request
  *
  * \note If D-cache is enabled, this function cleans D-cache of DMA descriptor.
  */
 cy_rslt_t mtb_hal_dma_set_length(mtb_hal_dma_t* obj, uint32_t length);
 
+/** Set the source address, destination address and length of the DMA transfer in one call
+ *
+ * Equivalent to \ref mtb_hal_dma_set_src_addr, \ref mtb_hal_dma_set_dst_addr and
+ * \ref mtb_hal_dma_set_length followed by \ref mtb_hal_dma_enable, but the arguments are checked
+ * and the descriptor is cleaned from the D-cache only once. Intended for re-arming a channel from
+ * its completion callback. If the length is rejected the descriptor is left unchanged.
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] src_addr The source address
+ * @param[in] dst_addr The destination address
+ * @param[in] length   The transfer length, in elements of the configured data size
+ * @param[in] enable   Whether to enable the channel once the descriptor is updated. A channel
+ *                     driven by a peripheral trigger then starts on the next trigger; a
+ *                     software-triggered channel still needs \ref mtb_hal_dma_start_transfer.
+ * @return The status of the request
+ *
+ * \note If D-cache is enabled, this function cleans D-cache of DMA descriptor.
+ */
+cy_rslt_t mtb_hal_dma_set_transfer(mtb_hal_dma_t* obj, uint32_t src_addr, uint32_t dst_addr,
+                                   uint32_t length, bool enable);
+
+/** Configure the DMA descriptor to restart itself each time it completes
+ *
+ * When enabled, the descriptor is chained to itself and the channel stays enabled after the
+ * last element, so a hardware-triggered transfer runs continuously over the same buffer. This is
+ * typically used to receive peripheral data into a ring buffer. When disabled, the descriptor
+ * stops after one pass and disables the channel.
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] enable   True to make the transfer circular, false for a single pass
+ * @return The status of the request
+ *
+ * \note If D-cache is enabled, this function cleans D-cache of DMA descriptor.
+ */
+cy_rslt_t mtb_hal_dma_set_circular(mtb_hal_dma_t* obj, bool enable);
+
+/** Get the number of elements moved so far by the current pass of the DMA descriptor
+ *
+ * The value returns to zero each time the descriptor completes, so for circular transfers
+ * (\ref mtb_hal_dma_set_circular) it is the current write position within the buffer.
+ *
+ * @param[in] obj      The DMA object
+ * @return Number of elements transferred in the current pass
+ */
+uint32_t mtb_hal_dma_get_transfer_index(mtb_hal_dma_t* obj);
+
+/** Build a linked descriptor chain from a scatter-gather list
+ *
+ * Each entry of `entries` is turned into one descriptor in `pool`, derived from the descriptor
+ * provided at setup, and the descriptors are linked so that the channel runs through the whole
+ * list. If the setup descriptor moves its data on a single trigger, one trigger moves the full
+ * list. A single \ref MTB_HAL_DMA_TRANSFER_COMPLETE / \ref MTB_HAL_DMA_DESCRIPTOR_COMPLETE
+ * event is raised at the end of the chain.
+ *
+ * The chain stays attached to the channel until \ref mtb_hal_dma_clear_scatter_gather is
+ * called. \ref mtb_hal_dma_set_src_addr, \ref mtb_hal_dma_set_dst_addr and
+ * \ref mtb_hal_dma_set_length keep acting on the setup descriptor.
+ *
+ * @param[in] obj        The DMA object
+ * @param[in] entries    The scatter-gather list
+ * @param[in] count      The number of entries in the list
+ * @param[in] pool       Descriptor storage used for the chain. It must remain valid while
+ *                       the chain is attached
+ * @param[in] pool_size  The number of descriptors in `pool`
+ * @return The status of the request
+ *
+ * \note If D-cache is enabled, this function cleans D-cache of the whole chain once.
+ */
+cy_rslt_t mtb_hal_dma_set_scatter_gather(mtb_hal_dma_t* obj, const mtb_hal_dma_sg_entry_t* entries,
+                                         size_t count, mtb_hal_dma_descriptor_t* pool,
+                                         size_t pool_size);
+
+/** Detach a scatter-gather chain and return to the descriptor provided at setup
+ *
+ * @param[in] obj        The DMA object
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_dma_clear_scatter_gather(mtb_hal_dma_t* obj);
+
 /** Enable the DMA transfer so that it can start transferring data when triggered. A trigger
  * is caused either by calling \ref mtb_hal_dma_start_transfer or by hardware as a result of
  * connection made using the interconnect components in the device configurator. The DMA can
@@ -294,6 +449,144 @@ void mtb_hal_dma_enable_event(mtb_hal_dma_t* obj, mtb_hal_dma_event_t event, boo
  * */
 uint32_t mtb_hal_dma_get_max_elements_per_burst(mtb_hal_dma_t* obj);
 
+/** Measure the size above which the DMA copies faster than the CPU and use it as threshold
+ *
+ * Copies blocks of doubling size from the first half of `scratch` to the second half, once with
+ * the CPU and once through the pool, timing both with the DWT cycle counter. The cost of the DMA
+ * includes the cache maintenance and the completion interrupt. Blocks until done. The threshold
+ * in use is left unchanged while measuring and when the measurement fails.
+ *
+ * @param[in] scratch      Memory the measurement may overwrite
+ * @param[in] size         Size of scratch in bytes, at least 64
+ * @return The status of the request. \ref MTB_HAL_DMA_RSLT_ERR_NOT_SUPPORTED on cores without a
+ * DWT cycle counter (CM0+) or if no channel was lent to the channel pool,
+ * \ref MTB_HAL_DMA_RSLT_WARN_NO_CHANNEL if none of them was free for a measurement.
+ */
+cy_rslt_t mtb_hal_dma_mem_calibrate(uint8_t* scratch, size_t size);
+
+/** Set the size below which memory transfers are done by the CPU
+ *
+ * @param[in] bytes        The threshold, in bytes. 0 sends every transfer to the DMA.
+ */
+void mtb_hal_dma_mem_set_threshold(uint32_t bytes);
+
+/** Get the size below which memory transfers are done by the CPU
+ *
+ * @return The threshold, in bytes
+ */
+uint32_t mtb_hal_dma_mem_get_threshold(void);
+
+/** Copy memory, see \ref section_dma_mem
+ *
+ * @param[out] xfer         Transfer state, valid until the transfer completes
+ * @param[in]  dst          Destination
+ * @param[in]  src          Source. Must not overlap the destination.
+ * @param[in]  length       Number of bytes to copy
+ * @param[in]  callback     Called on completion, may be NULL. Called from the DMA interrupt, or
+ *                          before this function returns if the CPU did the copy.
+ * @param[in]  callback_arg Generic argument that will be provided to the callback when called
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_dma_mem_copy(mtb_hal_dma_mem_xfer_t* xfer, void* dst, const void* src,
+                               size_t length, mtb_hal_dma_mem_callback_t callback,
+                               void* callback_arg);
+
+/** Fill memory with a byte value, see \ref section_dma_mem
+ *
+ * @param[out] xfer         Transfer state, valid until the transfer completes
+ * @param[in]  dst          Destination
+ * @param[in]  value        Value written to every byte
+ * @param[in]  length       Number of bytes to fill
+ * @param[in]  callback     Called on completion, may be NULL. See \ref mtb_hal_dma_mem_copy.
+ * @param[in]  callback_arg Generic argument that will be provided to the callback when called
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_dma_mem_fill(mtb_hal_dma_mem_xfer_t* xfer, void* dst, uint8_t value,
+                               size_t length, mtb_hal_dma_mem_callback_t callback,
+                               void* callback_arg);
+
+/** Copy a rectangular block between two buffers with their own row pitch, see
+ * \ref section_dma_mem
+ *
+ * Rows wider than a DMA loop, or pitches larger than a DMA loop increment, are copied by the CPU.
+ *
+ * @param[out] xfer         Transfer state, valid until the transfer completes
+ * @param[in]  dst          First byte of the destination block
+ * @param[in]  dst_stride   Distance between destination rows, in bytes
+ * @param[in]  src          First byte of the source block
+ * @param[in]  src_stride   Distance between source rows, in bytes
+ * @param[in]  width        Bytes per row
+ * @param[in]  height       Number of rows
+ * @param[in]  callback     Called on completion, may be NULL. See \ref mtb_hal_dma_mem_copy.
+ * @param[in]  callback_arg Generic argument that will be provided to the callback when called
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_dma_mem_copy_2d(mtb_hal_dma_mem_xfer_t* xfer, void* dst, uint32_t dst_stride,
+                                  const void* src, uint32_t src_stride, uint32_t width,
+                                  uint32_t height, mtb_hal_dma_mem_callback_t callback,
+                                  void* callback_arg);
+
+/** Get the state of a memory transfer
+ *
+ * @param[in] xfer         The transfer
+ * @return \ref MTB_HAL_DMA_RSLT_WARN_IN_PROGRESS until the transfer completes, then
+ * CY_RSLT_SUCCESS or the reason it stopped
+ */
+cy_rslt_t mtb_hal_dma_mem_get_status(const mtb_hal_dma_mem_xfer_t* xfer);
+
+/** Lend a channel to the channel pool, see \ref section_dma_pool
+ *
+ * The channel must be set up and idle and its interrupt must be routed to
+ * \ref mtb_hal_dma_process_interrupt. It is disabled until it is allocated.
+ *
+ * @param[in] obj          The DMA object
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_dma_pool_add_channel(mtb_hal_dma_t* obj);
+
+/** Take a channel back from the channel pool
+ *
+ * @param[in] obj          The DMA object
+ * @return The status of the request. \ref MTB_HAL_DMA_RSLT_WARN_IN_PROGRESS if the channel is
+ * allocated.
+ */
+cy_rslt_t mtb_hal_dma_pool_remove_channel(mtb_hal_dma_t* obj);
+
+/** Take a free channel from the channel pool
+ *
+ * The channel is returned disabled, without callback and with all events disabled, running at
+ * the requested arbitration priority.
+ *
+ * @param[out] obj          The allocated channel
+ * @param[in]  priority     Arbitration priority, 0 (highest) to
+ *                          \ref MTB_HAL_DMA_PRIORITY_LOWEST
+ * @param[in]  preferred    DMA type to take the channel from
+ * @param[in]  fallback     Whether a channel of the other DMA type may be used when no channel
+ *                          of the preferred type is free
+ * @return The status of the request. \ref MTB_HAL_DMA_RSLT_WARN_NO_CHANNEL if no channel is
+ * free.
+ */
+cy_rslt_t mtb_hal_dma_pool_alloc(mtb_hal_dma_t** obj, uint8_t priority,
+                                 mtb_hal_dma_type_t preferred, bool fallback);
+
+/** Give a channel back to the channel pool
+ *
+ * The channel is disabled, which stops any transfer still running, and its callback and events
+ * are cleared. May be called from the completion callback of the channel.
+ *
+ * @param[in] obj          The channel returned by \ref mtb_hal_dma_pool_alloc
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_dma_pool_free(mtb_hal_dma_t* obj);
+
+/** Get the usage of the channel pool
+ *
+ * @param[out] stats        Location to copy the usage to
+ * @param[in]  reset        Whether to clear the request counters and set the maxima to the
+ *                          current usage afterwards
+ */
+void mtb_hal_dma_pool_get_stats(mtb_hal_dma_pool_stats_t* stats, bool reset);
+
 #if defined(__cplusplus)
 }
 #endif
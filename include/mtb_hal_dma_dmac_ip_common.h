@@ -99,25 +99,24 @@ __STATIC_INLINE void _mtb_hal_dma_dmac_descriptor_set_dst_addr(mtb_hal_dma_t* ob
 }
 
 
-/** Set the transfer length */
-__STATIC_INLINE cy_rslt_t _mtb_hal_dma_dmac_descriptor_set_length(mtb_hal_dma_t* obj,
-                                                                  uint32_t length)
+/** Set the transfer length of the given descriptor */
+__STATIC_INLINE cy_rslt_t _mtb_hal_dma_dmac_descr_set_length(_mtb_hal_dmac_descriptor_t* descriptor,
+                                                             uint32_t length)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
-    cy_en_dmac_descriptor_type_t descr_type = Cy_DMAC_Descriptor_GetDescriptorType(
-        obj->descriptor.dmac);
+    cy_en_dmac_descriptor_type_t descr_type = Cy_DMAC_Descriptor_GetDescriptorType(descriptor);
     if (CY_DMAC_2D_TRANSFER == descr_type)
     {
         //This is based on the assumption that user/app does not want to change the burst size.
         //Length in case of 2-D transfers need to be a mutiple of the burst size.TODO: check this
-        uint32_t xloop_count = Cy_DMAC_Descriptor_GetXloopDataCount(obj->descriptor.dmac);
+        uint32_t xloop_count = Cy_DMAC_Descriptor_GetXloopDataCount(descriptor);
         if ((length > (xloop_count * CY_DMAC_LOOP_COUNT_MAX)) || (length % xloop_count))
         {
             result = MTB_HAL_DMA_RSLT_ERR_INVALID_TRANSFER_SIZE;
         }
         else
         {
-            Cy_DMAC_Descriptor_SetYloopDataCount(obj->descriptor.dmac, length/xloop_count);
+            Cy_DMAC_Descriptor_SetYloopDataCount(descriptor, length/xloop_count);
         }
     }
     else if (CY_DMAC_1D_TRANSFER == descr_type)
@@ -128,7 +127,7 @@ __STATIC_INLINE cy_rslt_t _mtb_hal_dma_dmac_descriptor_set_length(mtb_hal_dma_t*
         }
         else
         {
-            Cy_DMAC_Descriptor_SetXloopDataCount(obj->descriptor.dmac, length);
+            Cy_DMAC_Descriptor_SetXloopDataCount(descriptor, length);
         }
     }
     else
@@ -140,10 +139,104 @@ __STATIC_INLINE cy_rslt_t _mtb_hal_dma_dmac_descriptor_set_length(mtb_hal_dma_t*
 }
 
 
+/** Set the transfer length */
+__STATIC_INLINE cy_rslt_t _mtb_hal_dma_dmac_descriptor_set_length(mtb_hal_dma_t* obj,
+                                                                  uint32_t length)
+{
+    return _mtb_hal_dma_dmac_descr_set_length(obj->descriptor.dmac, length);
+}
+
+
+/** Link one descriptor of a scatter-gather chain. The last descriptor has no successor. */
+__STATIC_INLINE void _mtb_hal_dma_dmac_descr_set_chain(_mtb_hal_dmac_descriptor_t* descriptor,
+                                                       _mtb_hal_dmac_descriptor_t* next,
+                                                       bool chain_trigger)
+{
+    Cy_DMAC_Descriptor_SetInterruptType(descriptor, CY_DMAC_DESCR_CHAIN);
+    if (chain_trigger)
+    {
+        Cy_DMAC_Descriptor_SetTriggerInType(descriptor, CY_DMAC_DESCR_CHAIN);
+    }
+    Cy_DMAC_Descriptor_SetNextDescriptor(descriptor, next);
+    if (NULL != next)
+    {
+        Cy_DMAC_Descriptor_SetChannelState(descriptor, CY_DMAC_CHANNEL_ENABLED);
+    }
+}
+
+
+/** Rewrite a descriptor as a memory transfer run by one software trigger */
+__STATIC_INLINE void _mtb_hal_dma_dmac_descr_set_mem(_mtb_hal_dmac_descriptor_t* descriptor,
+                                                     const _mtb_hal_dma_mem_descr_t* descr)
+{
+    Cy_DMAC_Descriptor_SetDescriptorType(descriptor, CY_DMAC_2D_TRANSFER);
+    Cy_DMAC_Descriptor_SetSrcAddress(descriptor, (void*)descr->src);
+    Cy_DMAC_Descriptor_SetDstAddress(descriptor, (void*)descr->dst);
+    Cy_DMAC_Descriptor_SetDataSize(descriptor, (cy_en_dmac_data_size_t)descr->data_size);
+    Cy_DMAC_Descriptor_SetSrcTransferSize(descriptor, CY_DMAC_TRANSFER_SIZE_DATA);
+    Cy_DMAC_Descriptor_SetDstTransferSize(descriptor, CY_DMAC_TRANSFER_SIZE_DATA);
+    Cy_DMAC_Descriptor_SetXloopDataCount(descriptor, descr->x_count);
+    Cy_DMAC_Descriptor_SetXloopSrcIncrement(descriptor, descr->x_src_inc);
+    Cy_DMAC_Descriptor_SetXloopDstIncrement(descriptor, descr->x_dst_inc);
+    Cy_DMAC_Descriptor_SetYloopDataCount(descriptor, descr->y_count);
+    Cy_DMAC_Descriptor_SetYloopSrcIncrement(descriptor, descr->y_src_inc);
+    Cy_DMAC_Descriptor_SetYloopDstIncrement(descriptor, descr->y_dst_inc);
+    Cy_DMAC_Descriptor_SetTriggerInType(descriptor, CY_DMAC_DESCR);
+    Cy_DMAC_Descriptor_SetTriggerOutType(descriptor, CY_DMAC_DESCR);
+    Cy_DMAC_Descriptor_SetInterruptType(descriptor, CY_DMAC_DESCR);
+    Cy_DMAC_Descriptor_SetRetrigger(descriptor, CY_DMAC_RETRIG_IM);
+    Cy_DMAC_Descriptor_SetNextDescriptor(descriptor, NULL);
+    Cy_DMAC_Descriptor_SetChannelState(descriptor, CY_DMAC_CHANNEL_DISABLED);
+}
+
+
+/** Check if the descriptor moves all of its data on a single trigger */
+__STATIC_INLINE bool _mtb_hal_dma_dmac_is_descr_trigger(mtb_hal_dma_t* obj)
+{
+    return (CY_DMAC_DESCR == Cy_DMAC_Descriptor_GetTriggerInType(obj->descriptor.dmac));
+}
+
+
+/** Point the channel at the given descriptor */
+__STATIC_INLINE void _mtb_hal_dma_dmac_channel_set_descriptor(mtb_hal_dma_t* obj,
+                                                              _mtb_hal_dmac_descriptor_t* descriptor)
+{
+    Cy_DMAC_Channel_SetDescriptor(obj->base.dmac_base, obj->channel, descriptor);
+}
+
+
+/** Chain the descriptor to itself (or break the chain) */
+__STATIC_INLINE void _mtb_hal_dma_dmac_descriptor_set_circular(mtb_hal_dma_t* obj, bool enable)
+{
+    Cy_DMAC_Descriptor_SetNextDescriptor(obj->descriptor.dmac,
+                                         enable ? obj->descriptor.dmac : NULL);
+    Cy_DMAC_Descriptor_SetChannelState(obj->descriptor.dmac,
+                                       enable ? CY_DMAC_CHANNEL_ENABLED : CY_DMAC_CHANNEL_DISABLED);
+}
+
+
+/** Get the number of elements transferred by the current pass of the descriptor */
+__STATIC_INLINE uint32_t _mtb_hal_dma_dmac_channel_get_transfer_index(mtb_hal_dma_t* obj)
+{
+    uint32_t index = Cy_DMAC_Channel_GetCurrentXloopIndex(obj->base.dmac_base, obj->channel);
+    if (CY_DMAC_2D_TRANSFER == Cy_DMAC_Descriptor_GetDescriptorType(obj->descriptor.dmac))
+    {
+        index += Cy_DMAC_Channel_GetCurrentYloopIndex(obj->base.dmac_base, obj->channel) *
+                 Cy_DMAC_Descriptor_GetXloopDataCount(obj->descriptor.dmac);
+    }
+    return index;
+}
+
+
 /** Get the expected bursts based on the descriptor configuration */
 __STATIC_INLINE uint32_t _mtb_hal_dma_dmac_get_expected_bursts(mtb_hal_dma_t* obj)
 {
     uint32_t expected_bursts = 1;
+    /* A descriptor chain raises a single interrupt at the end of the chain */
+    if (obj->chained)
+    {
+        return expected_bursts;
+    }
     cy_en_dmac_trigger_type_t intr_type = Cy_DMAC_Descriptor_GetInterruptType(
         obj->descriptor.dmac);
     if (CY_DMAC_DESCR == intr_type)
@@ -172,6 +265,13 @@ __STATIC_INLINE void _mtb_hal_dma_dmac_channel_disable(mtb_hal_dma_t* obj)
 }
 
 
+/** Set the arbitration priority of the DMA channel */
+__STATIC_INLINE void _mtb_hal_dma_dmac_channel_set_priority(mtb_hal_dma_t* obj, uint32_t priority)
+{
+    Cy_DMAC_Channel_SetPriority(obj->base.dmac_base, obj->channel, priority);
+}
+
+
 /** Get the active DMA channels */
 __STATIC_INLINE uint32_t _mtb_hal_dma_dmac_get_active_channels(mtb_hal_dma_t* obj)
 {
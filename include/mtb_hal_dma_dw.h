@@ -50,25 +50,89 @@ cy_rslt_t _mtb_hal_dma_dw_setup(mtb_hal_dma_t* obj, const mtb_hal_dma_configurat
  *
  * @param[in] obj      The DMA object
  * @param[in] src_addr The source address
+ * @param[in] clean    Whether to clean the descriptor from the D-cache after the write
  * @return The status of the request
  */
-cy_rslt_t _mtb_hal_dma_dw_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr);
+cy_rslt_t _mtb_hal_dma_dw_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr, bool clean);
 
 /** Set the destination address for the DMA transfer
  *
  * @param[in] obj       The DMA object
  * @param[in] dst_addr The destination address
+ * @param[in] clean    Whether to clean the descriptor from the D-cache after the write
  * @return The status of the request
  */
-cy_rslt_t _mtb_hal_dma_dw_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr);
+cy_rslt_t _mtb_hal_dma_dw_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr, bool clean);
 
 /** Set the length for the DMA transfer
  *
  * @param[in] obj      The DMA object
- * @param[in] length   The transfer length, in bytes
+ * @param[in] length   The transfer length, in elements of the configured data size
+ * @param[in] clean    Whether to clean the descriptor from the D-cache after the write
  * @return The status of the request
  */
-cy_rslt_t _mtb_hal_dma_dw_set_length(mtb_hal_dma_t* obj, uint32_t length);
+cy_rslt_t _mtb_hal_dma_dw_set_length(mtb_hal_dma_t* obj, uint32_t length, bool clean);
+
+/** Clean the descriptor from the D-cache after writes made with the clean argument false
+ *
+ * @param[in] obj      The DMA object
+ */
+void _mtb_hal_dma_dw_clean_descriptor(mtb_hal_dma_t* obj);
+
+/** Set the source, destination and length of the DMA transfer with a single cache clean
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] src_addr The source address
+ * @param[in] dst_addr The destination address
+ * @param[in] length   The transfer length, in elements of the configured data size
+ * @param[in] enable   Whether to enable the channel once the descriptor is updated
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_dw_set_transfer(mtb_hal_dma_t* obj, uint32_t src_addr, uint32_t dst_addr,
+                                       uint32_t length, bool enable);
+
+/** Configure the descriptor to restart itself when it completes
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] enable   True to chain the descriptor to itself, false to stop after one pass
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_dw_set_circular(mtb_hal_dma_t* obj, bool enable);
+
+/** Get the number of elements transferred by the current pass of the descriptor
+ *
+ * @param[in] obj      The DMA object
+ * @return The number of elements transferred
+ */
+uint32_t _mtb_hal_dma_dw_get_transfer_index(mtb_hal_dma_t* obj);
+
+/** Build a linked descriptor chain from a scatter-gather list and attach it to the channel
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] entries  The scatter-gather list
+ * @param[in] count    The number of entries in the list
+ * @param[in] pool     Descriptor storage, at least `count` entries long
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_dw_set_scatter_gather(mtb_hal_dma_t* obj,
+                                             const mtb_hal_dma_sg_entry_t* entries,
+                                             size_t count, mtb_hal_dma_descriptor_t* pool);
+
+/** Attach the configurator-provided descriptor back to the channel
+ *
+ * @param[in] obj      The DMA object
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_dw_clear_scatter_gather(mtb_hal_dma_t* obj);
+
+/** Rewrite the descriptor as a software-triggered memory transfer and attach it to the channel
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] descr    The transfer to run
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_dw_set_mem_descriptor(mtb_hal_dma_t* obj,
+                                             const _mtb_hal_dma_mem_descr_t* descr);
 
 /** Enable the DMA transfer so that it can start transferring data when triggered. A trigger
  * is caused either by calling \ref mtb_hal_dma_start_transfer or by hardware as a result of
@@ -88,6 +152,13 @@ cy_rslt_t _mtb_hal_dma_dw_enable(mtb_hal_dma_t* obj);
  */
 cy_rslt_t _mtb_hal_dma_dw_disable(mtb_hal_dma_t* obj);
 
+/** Set the arbitration priority of the channel. The channel must be disabled.
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] priority The priority, 0 (highest) to \ref MTB_HAL_DMA_PRIORITY_LOWEST
+ */
+void _mtb_hal_dma_dw_set_priority(mtb_hal_dma_t* obj, uint8_t priority);
+
 /** Initiates DMA channel transfer for specified DMA object. This should only be done after the
  * channel has been configured and setup and any necessary event callbacks setup
  * (\ref mtb_hal_dma_register_callback \ref mtb_hal_dma_enable_event)
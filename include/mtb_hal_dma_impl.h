@@ -63,6 +63,62 @@ extern "C" {
 
 /** \} group_hal_impl_dma */
 
+/** \cond INTERNAL */
+
+/** Set the source address, optionally without cleaning the descriptor from the D-cache.
+ *
+ * Lets a caller that updates several descriptor fields clean the descriptor once, with
+ * \ref _mtb_hal_dma_clean_descriptor, before the channel is enabled.
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] src_addr The source address
+ * @param[in] clean    Whether to clean the descriptor from the D-cache after the write
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr, bool clean);
+
+/** Set the destination address, optionally without cleaning the descriptor from the D-cache.
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] dst_addr The destination address
+ * @param[in] clean    Whether to clean the descriptor from the D-cache after the write
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr, bool clean);
+
+/** Set the transfer length, optionally without cleaning the descriptor from the D-cache.
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] length   The transfer length, in elements of the configured data size
+ * @param[in] clean    Whether to clean the descriptor from the D-cache after the write
+ * @return The status of the request
+ */
+cy_rslt_t _mtb_hal_dma_set_length(mtb_hal_dma_t* obj, uint32_t length, bool clean);
+
+/** Clean the descriptor from the D-cache. No-op on devices without a D-cache.
+ *
+ * @param[in] obj      The DMA object
+ */
+void _mtb_hal_dma_clean_descriptor(mtb_hal_dma_t* obj);
+
+/** Copy the channel's descriptor, including its chaining, so that a temporary user of the
+ * channel can put it back with \ref _mtb_hal_dma_restore_descriptor.
+ *
+ * @param[in]  obj     The DMA object
+ * @param[out] saved   Storage for the descriptor
+ */
+void _mtb_hal_dma_save_descriptor(mtb_hal_dma_t* obj, mtb_hal_dma_descriptor_t* saved);
+
+/** Write back a descriptor saved with \ref _mtb_hal_dma_save_descriptor and clean it from the
+ * D-cache. The channel must be disabled.
+ *
+ * @param[in] obj      The DMA object
+ * @param[in] saved    The saved descriptor
+ */
+void _mtb_hal_dma_restore_descriptor(mtb_hal_dma_t* obj, const mtb_hal_dma_descriptor_t* saved);
+
+/** \endcond */
+
 #if defined(__cplusplus)
 }
 #endif
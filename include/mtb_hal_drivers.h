@@ -35,6 +35,7 @@
 #include "mtb_hal_lptimer.h"
 #include "mtb_hal_memoryspi.h"
 #include "mtb_hal_nvm.h"
+#include "mtb_hal_perf.h"
 #include "mtb_hal_pwm.h"
 #include "mtb_hal_rtc.h"
 #include "mtb_hal_sdhc.h"
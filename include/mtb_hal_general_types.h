@@ -85,7 +85,9 @@ enum mtb_hal_rslt_module_chip
     MTB_HAL_RSLT_MODULE_SYSTEM        = (0x13),  //!< An error occurred in System module
     MTB_HAL_RSLT_MODULE_TIMER         = (0x14),  //!< An error occurred in Timer module
     MTB_HAL_RSLT_MODULE_TRNG          = (0x15),  //!< An error occurred in TRNG module
-    MTB_HAL_RSLT_MODULE_UART          = (0x16)   //!< An error occurred in UART module
+    MTB_HAL_RSLT_MODULE_UART          = (0x16),  //!< An error occurred in UART module
+    MTB_HAL_RSLT_MODULE_PERF          = (0x17)   //!< An error occurred in performance
+                                                 //!< instrumentation
 };
 
 /**
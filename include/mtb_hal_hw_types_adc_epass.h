@@ -25,6 +25,9 @@
 
 #include "cy_pdl.h"
 #include "mtb_hal_hw_types_clock.h"
+#include "mtb_hal_hw_types_dma.h"
+#include "mtb_hal_hw_types_timer.h"
+#include "mtb_hal_impl_types.h"
 
 #if defined(CY_IP_MXS40EPASS_ESAR)
 
@@ -67,6 +70,23 @@
 // PASS_SAR_SLICE_NR1_SAR_SAR_CHAN_NR)) && ((CY_IP_MXS40EPASS_ESAR_INSTANCES < 3) ||
 // (PASS_SAR_SLICE_NR0_SAR_SAR_CHAN_NR > PASS_SAR_SLICE_NR2_SAR_SAR_CHAN_NR)))
 
+#if defined(MTB_HAL_DRIVER_AVAILABLE_DMA) && defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+/** \cond INTERNAL */
+
+/* Streaming acquisition state, see mtb_hal_adc_stream_start. The ring holds two blocks. */
+typedef struct
+{
+    mtb_hal_dma_t*                      dma; /* NULL while not streaming */
+    uint16_t*                           buffer;
+    uint32_t                            block_elements; /* Results per block */
+    const mtb_hal_timer_t*              timer;
+    _mtb_hal_event_callback_data_t      callback_data;
+    bool                                half_reported; /* First block delivered for this pass */
+} _mtb_hal_adc_stream_t;
+
+/** \endcond */
+#endif // defined(MTB_HAL_DRIVER_AVAILABLE_DMA) && defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+
 /**
  * @brief ADC object
  *
@@ -80,6 +100,9 @@ typedef struct
     PASS_SAR_Type*                      base;
     const mtb_hal_clock_t*              clock;
     bool                                continuous_scanning;
+    #if defined(MTB_HAL_DRIVER_AVAILABLE_DMA) && defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+    _mtb_hal_adc_stream_t               stream;
+    #endif // defined(MTB_HAL_DRIVER_AVAILABLE_DMA) && defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
 } mtb_hal_adc_t;
 
 
@@ -54,6 +54,27 @@ typedef struct
     uint32_t              inst_num;  /**< Clock number */
 } mtb_hal_hf_clock_t;
 
+struct mtb_hal_clock_shared_s;
+
+/** A peripheral divider shared by several peripherals. See \ref mtb_hal_clock_shared_attach */
+typedef struct
+{
+    const mtb_hal_peri_div_t*       divider;    /**< The shared divider */
+    struct mtb_hal_clock_shared_s*  consumers;  /**< Internal: peripherals using the divider */
+} mtb_hal_clock_shared_div_t;
+
+/** Clock Reference Structure for one peripheral using a shared divider.
+ * Used with \ref mtb_hal_clock_shared_interface */
+typedef struct mtb_hal_clock_shared_s
+{
+    mtb_hal_clock_shared_div_t*     group;          /**< Internal: the shared divider */
+    struct mtb_hal_clock_shared_s*  next;           /**< Internal: next peripheral on the divider */
+    uint32_t                        frequency;      /**< Internal: required frequency, 0 if none */
+    uint32_t                        tolerance_ppm;  /**< Internal: tolerance on the frequency */
+    bool                            enabled;        /**< Internal: whether the peripheral needs
+                                                         the divider running */
+} mtb_hal_clock_shared_t;
+
 /** Get the clock frequency */
 typedef uint32_t (* mtb_hal_clock_get_frequency_hz_t)(const void* clock_ref);
 /** Set the clock frequency */
@@ -85,4 +106,51 @@ typedef struct
     const mtb_hal_clock_interface_t*     interface;
 } mtb_hal_clock_t;
 
+/** Phases of a CLK_HF frequency change, see \ref mtb_hal_clock_register_hf_callback */
+typedef enum
+{
+    /** The change is about to start. Return false to refuse it. Nothing may be modified yet. */
+    MTB_HAL_CLOCK_HF_CHECK_READY,
+    /** A later callback refused the change. Undo anything done during CHECK_READY. */
+    MTB_HAL_CLOCK_HF_CHECK_FAIL,
+    /** The change will happen right after all callbacks have run for this phase */
+    MTB_HAL_CLOCK_HF_BEFORE_CHANGE,
+    /** The change has happened */
+    MTB_HAL_CLOCK_HF_AFTER_CHANGE
+} mtb_hal_clock_hf_phase_t;
+
+/** Description of a CLK_HF frequency change */
+typedef struct
+{
+    uint32_t inst_num;  /**< The CLK_HF being changed */
+    uint32_t old_hz;    /**< Frequency before the change */
+    uint32_t new_hz;    /**< Frequency after the change */
+} mtb_hal_clock_hf_change_t;
+
+/** CLK_HF change callback. The return value is only used in \ref MTB_HAL_CLOCK_HF_CHECK_READY */
+typedef bool (* mtb_hal_clock_hf_callback_t)(const mtb_hal_clock_hf_change_t* change,
+                                             mtb_hal_clock_hf_phase_t phase, void* callback_arg);
+
+/** CLK_HF change callback registration. Allocated by the caller, populated by the HAL. */
+typedef struct mtb_hal_clock_hf_callback_data_s
+{
+    mtb_hal_clock_hf_callback_t                 callback;   /**< Internal: the callback */
+    void*                                       arg;        /**< Internal: callback argument */
+    struct mtb_hal_clock_hf_callback_data_s*    next;       /**< Internal: next registration */
+} mtb_hal_clock_hf_callback_data_t;
+
+/** Keeps a peripheral clock at its frequency across CLK_HF changes.
+ * See \ref mtb_hal_clock_hold_peri_freq */
+typedef struct
+{
+    mtb_hal_clock_hf_callback_data_t    cb_data;        /**< Internal: CLK_HF registration */
+    const mtb_hal_clock_t*              clock;          /**< Internal: the held clock */
+    uint32_t                            frequency;      /**< Internal: the held frequency */
+    uint32_t                            tolerance_ppm;  /**< Internal: allowed deviation */
+    uint32_t                            divider;        /**< Internal: divider planned for the
+                                                             pending change */
+    bool                                affected;       /**< Internal: whether the pending
+                                                             change reaches this clock */
+} mtb_hal_clock_peri_hold_t;
+
 #endif // defined(CY_IP_MXS22SRSS) || defined(CY_IP_MXS40SRSS) || defined(CY_IP_MXS40SSRSS)
@@ -82,6 +82,24 @@ typedef enum
     MTB_HAL_DMA_DMAC = 1
 } mtb_hal_dma_type_t;
 
+/** \cond INTERNAL */
+/** One descriptor of a memory transfer. Counts and increments are in elements. */
+typedef struct
+{
+    uint32_t                                 src;
+    uint32_t                                 dst;
+    uint8_t                                  data_size; /* log2 of the element size */
+    uint32_t                                 x_count;
+    int32_t                                  x_src_inc;
+    int32_t                                  x_dst_inc;
+    uint32_t                                 y_count;
+    int32_t                                  y_src_inc;
+    int32_t                                  y_dst_inc;
+} _mtb_hal_dma_mem_descr_t;
+/** \endcond */
+
+struct mtb_hal_dma_mem_xfer_s;
+
 /**
  * @brief DMA object
  *
@@ -89,7 +107,7 @@ typedef enum
  * They are considered an implementation detail which is subject to change
  * between platforms and/or HAL releases.
  */
-typedef struct
+typedef struct mtb_hal_dma_s
 {
     union
     {
@@ -111,12 +129,58 @@ typedef struct
     } descriptor;
     mtb_hal_dma_type_t                       dma_type;
     uint32_t                                 channel;
+    bool                                     chained; /* scatter-gather chain attached */
     uint16_t                                 expected_bursts;
     uint32_t                                 direction; /* really a mtb_hal_dma_direction_t */
     uint32_t                                 irq_cause;
     _mtb_hal_event_callback_data_t           callback_data;
+    struct mtb_hal_dma_mem_xfer_s*           mem_xfer; /* memory transfer using the channel */
+    struct mtb_hal_dma_s*                    pool_next; /* next channel of the allocator pool */
+    bool                                     pool_used; /* allocated from the allocator pool */
+    #if defined(MTB_HAL_PERF_ENABLE)
+    mtb_hal_perf_counters_t                  perf; /* performance counters */
+    uint32_t                                 perf_start; /* cycle count when last started */
+    #endif /* defined(MTB_HAL_PERF_ENABLE) */
 } mtb_hal_dma_t;
 
+/**
+ * @brief DMA descriptor storage
+ *
+ * Storage for one hardware descriptor of either DMA type. Used to provide the descriptor pool
+ * for scatter-gather chains.
+ */
+typedef union
+{
+    #if defined (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    _mtb_hal_dw_descriptor_t                 dw; //!< DW descriptor
+    #endif
+    #if defined (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    _mtb_hal_dmac_descriptor_t               dmac; //!< DMAC descriptor
+    #endif
+} mtb_hal_dma_descriptor_t;
+
+/**
+ * @brief Memory transfer
+ *
+ * State of one copy or fill started with the memory transfer functions. The caller allocates it
+ * and keeps it valid until the transfer completes.
+ */
+typedef struct mtb_hal_dma_mem_xfer_s
+{
+    _mtb_hal_dma_mem_descr_t                 descr; /* next descriptor to run */
+    uint32_t                                 rows; /* rows of descr left to run */
+    uint32_t                                 tail; /* elements of the last, partial row */
+    uint32_t                                 pattern; /* fill value, source of a fill */
+    uint32_t                                 src_addr; /* source range to clean, 0 for a fill */
+    uint32_t                                 src_span;
+    uint32_t                                 dst_addr; /* destination range to invalidate */
+    uint32_t                                 dst_span;
+    mtb_hal_dma_t*                           channel; /* channel running the transfer */
+    mtb_hal_dma_descriptor_t                 saved_descr; /* pool user's channel descriptor */
+    _mtb_hal_event_callback_data_t           callback_data;
+    volatile cy_rslt_t                       status;
+} mtb_hal_dma_mem_xfer_t;
+
 /**
  * @brief DMA configurator struct
  *
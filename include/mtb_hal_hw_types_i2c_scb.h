@@ -54,6 +54,32 @@
 #define MTB_HAL_MAP_I2C_GENERAL_CALL_EVENT                    (CY_SCB_I2C_GENERAL_CALL_EVENT)
 #define MTB_HAL_MAP_I2C_ADDR_IN_FIFO_EVENT                    (CY_SCB_I2C_ADDR_IN_FIFO_EVENT)
 
+/** \cond INTERNAL */
+
+/* Controller transaction queue state, see mtb_hal_i2c_queue_start. Named forward declaration
+ * because the transaction type is part of the public I2C API. */
+struct mtb_hal_i2c_transaction;
+typedef struct
+{
+    struct mtb_hal_i2c_transaction**    storage;
+    uint8_t                             size;
+    volatile uint8_t                    head; /* Oldest transaction, the one on the bus */
+    volatile uint8_t                    count;
+    volatile bool                       read_phase; /* Head is in its (repeated start) read */
+} _mtb_hal_i2c_queue_t;
+
+/* Target register map state, see mtb_hal_i2c_target_regmap_start. Named forward declaration
+ * because the map type is part of the public I2C API. */
+struct mtb_hal_i2c_regmap;
+typedef struct
+{
+    const struct mtb_hal_i2c_regmap*    map; /* NULL when the register map is not in use */
+    uint8_t* volatile                   data; /* Bank currently served to the controller */
+    volatile uint16_t                   pointer; /* Register the next access starts at */
+} _mtb_hal_i2c_regmap_state_t;
+
+/** \endcond */
+
 /**
  * @brief I2C object
  *
@@ -75,6 +101,8 @@ typedef struct
     _mtb_hal_buffer_info_t              tx_target_buff; //!< Target buffer for transmit operations
     // I2C reconfigures at run-time using this structure, so keep track of it
     const cy_stc_scb_i2c_config_t*      config; //!< PDL-level configuration structure
+    _mtb_hal_i2c_queue_t                queue; //!< Controller transaction queue
+    _mtb_hal_i2c_regmap_state_t         regmap; //!< Target register map
 } mtb_hal_i2c_t;
 
 /**
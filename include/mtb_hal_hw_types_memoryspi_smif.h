@@ -24,6 +24,7 @@
 #pragma once
 
 #include "cy_pdl.h"
+#include "mtb_hal_hw_types_timer.h"
 
 #if defined(CY_IP_MXSMIF)
 
@@ -40,6 +41,52 @@
 /** \} group_hal_availability */
 
 
+/** \cond INTERNAL */
+
+/* Read cache state, see mtb_hal_memoryspi_cache_enable. Named forward declaration because the
+ * command type is part of the public MemorySPI API. */
+struct mtb_hal_memoryspi_command;
+typedef struct
+{
+    const struct mtb_hal_memoryspi_command* read_command;
+    uint8_t*                            storage; /* num_sets * ways lines of line_size bytes */
+    uint32_t*                           tags; /* Per line: address | flags, last use stamp */
+    uint32_t                            line_size;
+    uint32_t                            num_sets;
+    uint8_t                             ways;
+    bool                                prefetch;
+    uint32_t                            use_stamp;
+    uint32_t                            last_miss; /* Line address of the last miss */
+    volatile bool                       prefetch_busy;
+    uint32_t                            prefetch_slot;
+    uint32_t                            prefetch_addr;
+    uint32_t                            hits;
+    uint32_t                            misses;
+    uint32_t                            prefetches;
+    uint32_t                            prefetch_hits;
+    uint32_t                            invalidations;
+} _mtb_hal_memoryspi_cache_t;
+
+/* Command batch state, see mtb_hal_memoryspi_batch_start */
+struct mtb_hal_memoryspi_batch_step;
+typedef struct
+{
+    const struct mtb_hal_memoryspi_batch_step*  steps;
+    uint32_t                            count;
+    volatile uint32_t                   index; /* Step currently on the bus */
+    uint32_t                            polls; /* Status reads done by the current poll step */
+    uint8_t                             poll_status;
+    volatile bool                       active;
+    volatile bool                       running; /* A context is issuing steps */
+    volatile bool                       kick; /* A step finished while running */
+    volatile cy_rslt_t                  result;
+    #if defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+    mtb_hal_timer_t*                    poll_timer; /* Spaces the reads of a poll step */
+    #endif
+} _mtb_hal_memoryspi_batch_t;
+
+/** \endcond */
+
 /**
  * @brief MemorySPI object
  *
@@ -57,6 +104,8 @@ typedef struct
     uint32_t                            enabled_events; //!< Events enabled by the user
     _mtb_hal_event_callback_data_t      callback_data;  //!< Registered callback, if any
     const mtb_hal_clock_t*              clock;          //!< Associated clock instance
+    _mtb_hal_memoryspi_cache_t          cache;          //!< Optional read cache
+    _mtb_hal_memoryspi_batch_t          batch;          //!< Command batch in progress
 } mtb_hal_memoryspi_t;
 
 /**
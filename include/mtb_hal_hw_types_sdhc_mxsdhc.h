@@ -42,6 +42,35 @@
 /** \} group_hal_availability */
 
 
+/** \cond INTERNAL */
+
+/* Streaming mode state, see mtb_hal_sdhc_stream_start. Named forward declaration because the
+ * request type is part of the public SDHC API. */
+struct mtb_hal_sdhc_stream_request;
+typedef struct
+{
+    struct mtb_hal_sdhc_stream_request**    queue;
+    uint8_t                                 queue_size;
+    volatile uint8_t                        head; /* Oldest request, the one on the bus */
+    volatile uint8_t                        count;
+    uint8_t                                 max_segments;
+    uint32_t*                               adma_tbl[2];
+    volatile uint8_t                        active_tbl;
+    /* Table of the request behind head is already built in adma_tbl[active_tbl ^ 1] */
+    volatile bool                           next_ready;
+    uint32_t                                (* get_ticks)(void);
+    uint32_t                                issue_ticks;
+    uint64_t                                bytes;
+    uint32_t                                commands;
+    uint32_t                                errors;
+    uint8_t                                 depth_max;
+    uint32_t                                latency_last;
+    uint32_t                                latency_max;
+    uint64_t                                latency_total;
+} _mtb_hal_sdhc_stream_t;
+
+/** \endcond */
+
 /**
  * @brief SDHC object
  *
@@ -65,6 +94,7 @@ typedef struct
                                                                 //!< voltage
     uint16_t                            emmc_generic_cmd6_time_ms; //!< Maximum timeout for CMD6
                                                                    //!< (swwitch command)
+    _mtb_hal_sdhc_stream_t              stream; //!< Streaming mode state
 } mtb_hal_sdhc_t;
 
 /**
@@ -66,6 +66,9 @@ typedef struct
     mtb_hal_gpio_t                      pin_data3; //!< Pin connected to data bus bit 3
 
     uint16_t                            block_size; //!< Size configured for block transfers
+    #if defined(MTB_HAL_PERF_ENABLE)
+    mtb_hal_perf_counters_t             perf; //!< Performance counters
+    #endif // defined(MTB_HAL_PERF_ENABLE)
 } mtb_hal_sdio_t;
 
 /**
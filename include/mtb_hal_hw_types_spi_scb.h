@@ -47,6 +47,40 @@
 #define MTB_HAL_MAP_SPI_IRQ_DONE                              (CY_SCB_SPI_TRANSFER_CMPLT_EVENT)
 #define MTB_HAL_MAP_SPI_IRQ_ERROR                             (CY_SCB_SPI_TRANSFER_ERR_EVENT)
 
+/** \cond INTERNAL */
+
+/* Transfer descriptor queue state, see mtb_hal_spi_queue_start. Named forward declaration because
+ * the descriptor type is part of the public SPI API. */
+struct mtb_hal_spi_xfer_desc;
+typedef struct
+{
+    struct mtb_hal_spi_xfer_desc**      storage;
+    uint8_t                             size;
+    volatile uint8_t                    head; /* Oldest descriptor, the one on the bus */
+    volatile uint8_t                    count;
+} _mtb_hal_spi_queue_t;
+
+/* Polled exchange of frames held in elements of the width selected at setup */
+typedef cy_rslt_t (* _mtb_hal_spi_put_get_func_t)(CySCB_Type* base, const void* tx, void* rx,
+                                                  size_t count, uint32_t fill, uint32_t timeout);
+
+#if defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
+/* Target streaming state, see mtb_hal_spi_target_stream_start */
+typedef struct
+{
+    mtb_hal_gpio_t*                     select; /* Target select input, NULL when not streaming */
+    uint8_t*                            rx_buffer[2];
+    size_t                              size; /* Size of each receive buffer, in bytes */
+    uint8_t                             active; /* Receive buffer the DMA is writing into */
+    volatile bool                       overflow; /* Active buffer filled before the frame ended */
+    const uint8_t*                      tx;
+    size_t                              tx_length;
+    _mtb_hal_event_callback_data_t      callback_data;
+} _mtb_hal_spi_stream_t;
+#endif // defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
+
+/** \endcond */
+
 /**
  * @brief SPI object
  *
@@ -62,7 +96,12 @@ typedef struct
     uint16_t volatile                   pending; //!< Flags for pending operations
     bool                                is_target; //!< Configured as target
     uint8_t                             data_bits; //!< Width of data bus
+    uint8_t                             word_shift; //!< log2 of the bytes each frame occupies
+                                                    //!< in user buffers
+    _mtb_hal_spi_put_get_func_t         put_get; //!< Polled exchange routine for the data width
     uint32_t                            irq_cause; //!< User-enabled events
+    uint32_t                            pending_events; //!< Events raised in the current
+                                                        //!< interrupt pass
     uint8_t                             write_fill; //!< Placeholder value when reading more than
                                                     //!< writing
     void* rx_buffer; //!< Buffer for read operations
@@ -71,6 +110,13 @@ typedef struct
     uint32_t                            tx_buffer_size; //!< Size of write buffer
     bool                                is_async; //!< Is an async operation in progress
     _mtb_hal_event_callback_data_t      callback_data; //!< User-registered callback
+    _mtb_hal_spi_queue_t                queue; //!< Transfer descriptor queue
+    #if defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
+    mtb_hal_dma_t*                      dma_rx; //!< DMA channel draining the RX FIFO
+    mtb_hal_dma_t*                      dma_tx; //!< DMA channel filling the TX FIFO
+    bool volatile                       is_dma; //!< Current transfer is moved by DMA
+    _mtb_hal_spi_stream_t               stream; //!< Target streaming state
+    #endif // defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
 } mtb_hal_spi_t;
 
 /**
@@ -54,6 +54,11 @@
 #define MTB_HAL_MAP_UART_IRQ_TX_EMPTY                         (CY_SCB_UART_TRANSMIT_EMTPY)
 #define MTB_HAL_MAP_UART_IRQ_TX_FIFO                          (CY_SCB_UART_TRANSMIT_EMTPY << 1)
 #define MTB_HAL_MAP_UART_IRQ_RX_FIFO                          (CY_SCB_UART_TRANSMIT_EMTPY << 2)
+#define MTB_HAL_MAP_UART_IRQ_RX_RING_HALF                     (CY_SCB_UART_TRANSMIT_EMTPY << 3)
+#define MTB_HAL_MAP_UART_IRQ_RX_RING_FULL                     (CY_SCB_UART_TRANSMIT_EMTPY << 4)
+#define MTB_HAL_MAP_UART_IRQ_RX_RING_OVERFLOW                 (CY_SCB_UART_TRANSMIT_EMTPY << 5)
+#define MTB_HAL_MAP_UART_IRQ_RX_IDLE                          (CY_SCB_UART_TRANSMIT_EMTPY << 6)
+#define MTB_HAL_MAP_UART_IRQ_RX_TIMEOUT                       (CY_SCB_UART_TRANSMIT_EMTPY << 7)
 
 /**
  * @brief UART pin structure
@@ -66,6 +71,80 @@ typedef struct
     uint8_t         pinNum;     /**< Pin number */
 } _mtb_hal_uart_pin_t;
 
+#if defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
+/**
+ * @brief UART continuous DMA receive state
+ *
+ * Indices are free-running byte counts; the position in the buffer is the index masked with
+ * (size - 1).
+ */
+typedef struct
+{
+    mtb_hal_dma_t*                      dma; //!< DMA channel writing into the ring
+    uint8_t*                            buffer; //!< Ring storage
+    uint32_t                            size; //!< Ring size in bytes, power of two
+    volatile uint32_t                   laps; //!< Number of completed passes over the ring
+    volatile uint32_t                   tail; //!< Read index
+    uint32_t                            idle_head; //!< Write index at the previous idle check
+    bool                                half_reported; //!< Half event raised for this pass
+    bool                                idle_reported; //!< Idle event raised for this data
+    uint32_t                            rx_level; //!< RX FIFO trigger level before the ring
+    _mtb_hal_event_callback_data_t      dma_callback; //!< DMA callback before the ring
+    mtb_hal_dma_descriptor_t            dma_descr; //!< DMA descriptor before the ring
+    uint16_t                            dma_bursts; //!< DMA expected bursts before the ring
+    uint32_t                            dma_events; //!< DMA events enabled before the ring
+} _mtb_hal_uart_rx_ring_t;
+#endif // defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
+
+/**
+ * @brief UART raw FIFO mode state
+ *
+ * Both rings are single-producer, single-consumer. Indices are free-running byte counts; the
+ * position in a buffer is the index masked with (size - 1).
+ */
+typedef struct
+{
+    bool                                active; //!< Raw mode owns the SCB interrupt
+    uint8_t*                            rx_buffer; //!< Receive ring storage
+    uint32_t                            rx_mask; //!< Receive ring size minus one
+    volatile uint32_t                   rx_head; //!< Written by the interrupt handler
+    volatile uint32_t                   rx_tail; //!< Written by the reader
+    uint32_t                            rx_dropped; //!< Bytes dropped because the ring was full
+    uint8_t*                            tx_buffer; //!< Transmit ring storage
+    uint32_t                            tx_mask; //!< Transmit ring size minus one
+    volatile uint32_t                   tx_head; //!< Written by the writer
+    volatile uint32_t                   tx_tail; //!< Written by the interrupt handler
+    uint32_t                            rx_level; //!< RX FIFO trigger level before raw mode
+    uint32_t                            tx_level; //!< TX FIFO trigger level before raw mode
+} _mtb_hal_uart_raw_t;
+
+#if defined(COMPONENT_MW_ASYNC_TRANSFER)
+/**
+ * @brief UART adaptive FIFO trigger level state
+ *
+ * Levels use the SCB semantics: the RX trigger fires when the FIFO holds more than the level,
+ * the TX trigger when it holds fewer.
+ */
+typedef struct
+{
+    bool                                enabled; //!< Levels are tuned from observed traffic
+    bool                                dma; //!< Async transfers use DMA; levels are fixed
+    uint16_t                            rx_level; //!< Tuned RX trigger level
+    uint16_t                            tx_level; //!< Tuned TX trigger level
+    uint16_t                            rx_requested; //!< Level requested for the current read
+    uint16_t                            rx_applied; //!< Level currently programmed
+    uint16_t                            rx_last_count; //!< RX FIFO count at the previous check
+    uint32_t                            rx_bytes; //!< Bytes drained on RX level interrupts
+    uint32_t                            rx_interrupts; //!< RX level interrupts serviced
+    uint32_t                            tx_bytes; //!< Bytes written on TX level interrupts
+    uint32_t                            tx_interrupts; //!< TX level interrupts serviced
+    uint32_t                            tx_underruns; //!< TX level interrupts with an empty FIFO
+    uint32_t                            rx_timeouts; //!< Receive timeouts raised
+    uint32_t                            rx_timeout_bytes; //!< Bytes delivered by a timeout
+    uint32_t                            level_changes; //!< Trigger level adjustments
+} _mtb_hal_uart_fifo_adapt_t;
+#endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
+
 /**
  * @brief UART object
  *
@@ -80,7 +159,16 @@ typedef struct
     const mtb_hal_clock_t*              clock; //!< Clock interface
     _mtb_hal_event_callback_data_t      callback_data; //!< User-registered callback
     uint32_t                            irq_cause; //!< User-enabled events
+    uint32_t                            pending_events; //!< Events raised in the current
+                                                        //!< interrupt pass
     _mtb_hal_uart_pin_t                 tx_pin; //!< TX pin info
+    _mtb_hal_uart_raw_t                 raw; //!< Raw FIFO mode state
+    #if defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
+    _mtb_hal_uart_rx_ring_t             rx_ring; //!< Continuous DMA receive state
+    #endif // defined(MTB_HAL_DRIVER_AVAILABLE_DMA)
+    #if defined(MTB_HAL_PERF_ENABLE)
+    mtb_hal_perf_counters_t             perf; //!< Performance counters
+    #endif // defined(MTB_HAL_PERF_ENABLE)
     #if defined(COMPONENT_MW_ASYNC_TRANSFER)
     bool                                rts_enable; //!< Is the RTS pin connected to the SCB
     _mtb_hal_uart_pin_t                 rts_pin; //!< RTS pin info (if used)
@@ -89,6 +177,7 @@ typedef struct
     mtb_async_transfer_context_t*       async_ctx; //!< Context for async-transfer
     mtb_async_transfer_event_callback_t async_event_callback; //!< Callback registerd with
                                                               //!< async-transfer
+    _mtb_hal_uart_fifo_adapt_t          fifo_adapt; //!< Adaptive FIFO trigger level state
     #endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
 } mtb_hal_uart_t;
 
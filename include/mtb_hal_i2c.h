@@ -74,6 +74,42 @@
  *
  * \snippet hal_i2c.c snippet_mtb_hal_handle_i2c_events
  *
+ * \section subsection_i2c_queue Controller Transaction Queue
+ * \ref mtb_hal_i2c_controller_write and \ref mtb_hal_i2c_controller_read keep the CPU busy for
+ * the whole transfer. As an alternative, a controller can queue \ref mtb_hal_i2c_transaction_t
+ * descriptors with \ref mtb_hal_i2c_queue_submit after enabling the queue with
+ * \ref mtb_hal_i2c_queue_start. Each transaction is an optional write followed by an optional read
+ * to the same device, joined by a repeated start. Transactions are run from
+ * \ref mtb_hal_i2c_process_interrupt: the FIFOs are refilled and drained by the interrupt, and the
+ * next queued transaction is started as soon as the previous one completes, before its completion
+ * callback runs. This requires \ref mtb_hal_i2c_process_interrupt to be called from the SCB
+ * interrupt handler. The blocking controller functions report
+ * \ref MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY while transactions are pending.
+ *
+ * \section subsection_i2c_regmap Target Register Map
+ * A target can emulate a register-addressed device with \ref mtb_hal_i2c_target_regmap_start.
+ * The first one or two bytes of each write from the controller select a register pointer inside
+ * the application-declared \ref mtb_hal_i2c_regmap_t; the remaining bytes are stored from that
+ * register onwards. A read returns the registers from the pointer onwards and is served by the
+ * SCB directly from the register array, so the controller always sees the current values without
+ * a copy or a round trip through the application. The pointer advances past each register
+ * accessed. Each range of registers is described by a \ref mtb_hal_i2c_reg_region_t giving its
+ * access rights; writes to read-only registers are dropped. The application is notified from
+ * interrupt context of each writable range written and of each volatile range read. A second
+ * register array can be swapped in with \ref mtb_hal_i2c_target_regmap_set_bank to publish a
+ * consistent set of values at once; the switch takes effect with the next transaction.
+ *
+ * \section subsection_i2c_timing Controller Timing
+ * A controller searches the SCB clock frequencies the divider can produce and the number of SCB
+ * clocks in the SCL low and high phases for the highest data rate that does not exceed the
+ * requested one. The SCL period is the low and high phases plus the SCL rise time and the clocks
+ * the SCB needs to see SCL go high, so the rise time measured on the bus should be given in
+ * \ref mtb_hal_i2c_cfg_t for the bus to run close to the requested rate. The low and high
+ * phases are kept at or above the minimum of the I2C mode, or the longer times the targets on
+ * the bus require. The chosen timing and its margins are reported through
+ * \ref mtb_hal_i2c_cfg_t::timing. Only the dividers of a peripheral clock are searched; other
+ * clock sources are set to a fixed frequency per I2C mode.
+ *
  * \section subsection_i2c_moreinformation More Information
  *
  * <b>Peripheral Driver Library (PDL)</b>
@@ -119,6 +155,15 @@ extern "C" {
 /** RX or TX Buffer is not initialized */
 #define MTB_HAL_I2C_RSLT_ERR_BUFFERS_NULL_PTR             \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_I2C, 3))
+/** Transaction queue is full */
+#define MTB_HAL_I2C_RSLT_ERR_QUEUE_FULL                   \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_I2C, 4))
+/** Queued transaction failed on the bus (NAK, arbitration lost or bus error) */
+#define MTB_HAL_I2C_RSLT_ERR_TRANSACTION                  \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_I2C, 5))
+/** Queued transaction was dropped by \ref mtb_hal_i2c_queue_stop */
+#define MTB_HAL_I2C_RSLT_ERR_ABORTED                      \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_I2C, 6))
 
 /** Timeout warning */
 #define MTB_HAL_I2C_RSLT_WARN_TIMEOUT                     \
@@ -208,6 +253,102 @@ typedef mtb_hal_i2c_command_rsp_t (* mtb_hal_i2c_address_callback_t)(void* callb
                                                                      mtb_hal_i2c_addr_event_t event,
                                                                      uint8_t address);
 
+/** Handler for completion of a queued I2C transaction, see \ref mtb_hal_i2c_queue_submit */
+typedef void (* mtb_hal_i2c_transaction_callback_t)(void* callback_arg,
+                                                    struct mtb_hal_i2c_transaction* transaction);
+
+/** Queued I2C controller transaction: write `tx_size` bytes, then read `rx_size` bytes after a
+ * repeated start. Either phase can be empty, but not both. The transaction and its buffers are
+ * owned by the application and must stay valid until the driver sets `complete`. */
+typedef struct mtb_hal_i2c_transaction
+{
+    //! Device address (7-bit)
+    uint16_t                            address;
+    //! Data to write, may be NULL when tx_size is 0
+    const uint8_t*                      tx;
+    //! Number of bytes to write
+    uint16_t                            tx_size;
+    //! Buffer for the read data, may be NULL when rx_size is 0
+    uint8_t*                            rx;
+    //! Number of bytes to read
+    uint16_t                            rx_size;
+    //! Called from interrupt context once the transaction has finished, may be NULL
+    mtb_hal_i2c_transaction_callback_t  callback;
+    //! Generic argument that will be provided to the callback when called
+    void*                               callback_arg;
+    //! Set by the driver once the transaction has finished
+    volatile bool                       complete;
+    //! Result of the transaction, valid once complete is set
+    volatile cy_rslt_t                  result;
+} mtb_hal_i2c_transaction_t;
+
+/** Register access rights in a \ref mtb_hal_i2c_regmap_t */
+typedef enum
+{
+    MTB_HAL_I2C_REG_READ_ONLY,  //!< Controller writes are dropped
+    MTB_HAL_I2C_REG_READ_WRITE, //!< Controller writes are stored and notified
+    MTB_HAL_I2C_REG_VOLATILE    //!< Read-write; controller reads are notified as well, e.g. to
+                                //!< implement clear-on-read status registers
+} mtb_hal_i2c_reg_access_t;
+
+/** Register map events, see \ref mtb_hal_i2c_regmap_callback_t */
+typedef enum
+{
+    MTB_HAL_I2C_REGMAP_WRITE,   //!< The controller wrote the registers
+    MTB_HAL_I2C_REGMAP_READ     //!< The controller read the volatile registers
+} mtb_hal_i2c_regmap_event_t;
+
+/** Handler for register map accesses. Called from interrupt context once per region accessed,
+ * with the first register and the number of registers of the region that were accessed. */
+typedef void (* mtb_hal_i2c_regmap_callback_t)(void* callback_arg,
+                                               mtb_hal_i2c_regmap_event_t event, uint16_t reg,
+                                               uint16_t count);
+
+/** Range of registers sharing the same access rights */
+typedef struct
+{
+    uint16_t                            start; //!< First register of the range
+    uint16_t                            count; //!< Number of registers in the range
+    mtb_hal_i2c_reg_access_t            access; //!< Access rights of the range
+} mtb_hal_i2c_reg_region_t;
+
+/** Register map served by a target, see \ref subsection_i2c_regmap. Registers are one byte wide;
+ * registers not covered by a region are read-only. The map and its buffers are owned by the
+ * application and must stay valid until \ref mtb_hal_i2c_target_regmap_stop is called. */
+typedef struct mtb_hal_i2c_regmap
+{
+    //! Register values, indexed by register address
+    uint8_t*                            data;
+    //! Number of registers
+    uint16_t                            size;
+    //! Number of register address bytes sent by the controller (1 or 2, most significant first)
+    uint8_t                             address_bytes;
+    //! Access rights of the registers
+    const mtb_hal_i2c_reg_region_t*     regions;
+    //! Number of entries in regions
+    uint8_t                             region_count;
+    //! Receives each controller write; must hold the address bytes plus the longest write
+    uint8_t*                            write_buffer;
+    //! Size of write_buffer in bytes
+    uint16_t                            write_buffer_size;
+    //! Called on register accesses, may be NULL
+    mtb_hal_i2c_regmap_callback_t       callback;
+    //! Generic argument that will be provided to the callback when called
+    void*                               callback_arg;
+} mtb_hal_i2c_regmap_t;
+
+/** SCL timing achieved by a controller, reported by \ref mtb_hal_i2c_configure.
+ * See \ref subsection_i2c_timing */
+typedef struct
+{
+    uint32_t data_rate_hz;      //!< Estimated bus data rate, including the SCL rise time
+    uint32_t clock_hz;          //!< Frequency of the clock feeding the SCB
+    uint8_t  low_cycles;        //!< SCB clocks in the SCL low phase
+    uint8_t  high_cycles;       //!< SCB clocks in the SCL high phase
+    uint16_t low_margin_ns;     //!< Margin of the SCL low time over the required minimum
+    uint16_t high_margin_ns;    //!< Margin of the SCL high time over the required minimum
+} mtb_hal_i2c_timing_t;
+
 /** @brief I2C configuration */
 typedef struct
 {
@@ -222,6 +363,18 @@ typedef struct
     bool     enable_address_callback;   /**<  Indicates address callback feature is enabled or
                                               disable. When it's true the address callback will be
                                               invoked. */
+    uint16_t rise_time_ns;              /**<  SCL rise time on the bus (30% to 70%). 0 assumes an
+                                              ideal edge, in which case the bus runs slower than
+                                              requested by the actual rise time. Controller
+                                              only. */
+    uint16_t min_low_ns;                /**<  Longest SCL low time required by a target on the
+                                              bus, or 0 for the minimum of the I2C mode. Controller
+                                              only. */
+    uint16_t min_high_ns;               /**<  Longest SCL high time required by a target on the
+                                              bus, or 0 for the minimum of the I2C mode. Controller
+                                              only. */
+    mtb_hal_i2c_timing_t* timing;       /**<  Receives the SCL timing chosen for a controller. May
+                                              be NULL. */
 } mtb_hal_i2c_cfg_t;
 
 /** Configure the I2C block.
@@ -272,6 +425,82 @@ cy_rslt_t mtb_hal_i2c_controller_write(mtb_hal_i2c_t* obj, uint16_t dev_addr, co
 cy_rslt_t mtb_hal_i2c_controller_read(mtb_hal_i2c_t* obj, uint16_t dev_addr, uint8_t* data,
                                       uint16_t size, uint32_t timeout, bool send_stop);
 
+/** Enable the controller transaction queue, see \ref subsection_i2c_queue.
+ *
+ * The block must be configured as a controller.
+ *
+ * @param[in]  obj        The I2C object
+ * @param[in]  storage    Array of `size` transaction pointers used as the queue, owned by the
+ *                        application until \ref mtb_hal_i2c_queue_stop is called
+ * @param[in]  size       Number of entries in storage
+ * @return The status of the queue_start request
+ */
+cy_rslt_t mtb_hal_i2c_queue_start(mtb_hal_i2c_t* obj, mtb_hal_i2c_transaction_t** storage,
+                                  uint8_t size);
+
+/** Queue a controller transaction.
+ *
+ * The transaction is started immediately if the bus is idle, otherwise when all previously queued
+ * transactions have finished. May be called from a transaction callback.
+ *
+ * @param[in]  obj          The I2C object
+ * @param[in]  transaction  The transaction to queue
+ * @return The status of the queue_submit request. \ref MTB_HAL_I2C_RSLT_ERR_QUEUE_FULL if all
+ * queue entries are in use.
+ */
+cy_rslt_t mtb_hal_i2c_queue_submit(mtb_hal_i2c_t* obj, mtb_hal_i2c_transaction_t* transaction);
+
+/** Returns the number of queued transactions which have not finished yet
+ *
+ * @param[in]  obj        The I2C object
+ * @return The number of pending transactions, including the one on the bus
+ */
+uint32_t mtb_hal_i2c_queue_get_count(mtb_hal_i2c_t* obj);
+
+/** Disable the controller transaction queue.
+ *
+ * The transaction on the bus is aborted. It and all transactions still queued complete with
+ * \ref MTB_HAL_I2C_RSLT_ERR_ABORTED.
+ *
+ * @param[in]  obj        The I2C object
+ * @return The status of the queue_stop request
+ */
+cy_rslt_t mtb_hal_i2c_queue_stop(mtb_hal_i2c_t* obj);
+
+/** Serve a register map as a target, see \ref subsection_i2c_regmap.
+ *
+ * The block must be configured as a target and \ref mtb_hal_i2c_process_interrupt must be called
+ * from the SCB interrupt handler. While the map is in use, the target buffer functions report
+ * \ref MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY. Enabled events are still delivered to the callback
+ * registered with \ref mtb_hal_i2c_register_callback.
+ *
+ * @param[in]  obj        The I2C object
+ * @param[in]  map        The register map
+ * @return The status of the target_regmap_start request
+ */
+cy_rslt_t mtb_hal_i2c_target_regmap_start(mtb_hal_i2c_t* obj, const mtb_hal_i2c_regmap_t* map);
+
+/** Switch the register values served to the controller to another bank.
+ *
+ * Takes effect with the next transaction; a read in progress completes from the previous bank.
+ * Controller writes are stored into the bank being served.
+ *
+ * @param[in]  obj        The I2C object
+ * @param[in]  data       Register values, with as many entries as the map
+ * @return The status of the target_regmap_set_bank request
+ */
+cy_rslt_t mtb_hal_i2c_target_regmap_set_bank(mtb_hal_i2c_t* obj, uint8_t* data);
+
+/** Stop serving the register map. The target buffers must be configured again before using the
+ * target read and write functions. The map is only released between transactions; the
+ * application owns it again once this returns success.
+ *
+ * @param[in]  obj        The I2C object
+ * @return The status of the target_regmap_stop request, \ref MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY
+ * while a transaction is in progress
+ */
+cy_rslt_t mtb_hal_i2c_target_regmap_stop(mtb_hal_i2c_t* obj);
+
 /**
  * The function configures the read buffer on an I2C Target. This is the buffer that the target
  * recieves data into. The user needs to setup a new buffer every time (i.e. call \ref
@@ -30,6 +30,7 @@
 #if defined(COMPONENT_MW_ASYNC_TRANSFER)
 #include "mtb_async_transfer.h"
 #endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
+#include "mtb_hal_perf.h"
 
 /** \cond INTERNAL */
 
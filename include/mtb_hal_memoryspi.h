@@ -45,6 +45,8 @@
  * * Execute-In-Place (XIP) from external Quad SPI Flash
  * * Supports external serial memory initialization via Serial Flash Discoverable Parameters (SFDP)
  * standard
+ * * Optional set-associative read cache with sequential prefetch, see
+ * \ref subsection_memoryspi_read_cache
  *
  * \section subsection_memoryspi_code_snippets Code Snippets
  * \note The following snippets show commands specific to the
@@ -105,6 +107,21 @@
  * MMIO operations. For more details see SMIF XIP Initialization section of PDL documentation.
  * It's important to note that only blocking apis are allowed in this mode.
  *
+ * \section subsection_memoryspi_read_cache Read cache
+ * Every \ref mtb_hal_memoryspi_read sends the full instruction, address and dummy phases, so many
+ * small random reads (file system metadata, font glyphs, ...) spend most of their time on command
+ * overhead. \ref mtb_hal_memoryspi_cache_enable adds an N-way set-associative cache of
+ * application provided SRAM in front of the memory; \ref mtb_hal_memoryspi_cache_read then only
+ * accesses the memory for whole lines that are not cached yet. Lines are replaced least recently
+ * used first.
+ * When prefetch is enabled and two consecutive lines miss, the following line is fetched in the
+ * background with \ref mtb_hal_memoryspi_read_async; this requires
+ * \ref mtb_hal_memoryspi_process_interrupt to be called from the SMIF interrupt handler. Prefetch
+ * completions are consumed by the driver and not reported through the registered callback.
+ * Writes through \ref mtb_hal_memoryspi_write / \ref mtb_hal_memoryspi_write_async drop the
+ * affected lines, commands without data but with an address phase (e.g. erase) drop the whole
+ * cache. Changes made by other means must be followed by \ref mtb_hal_memoryspi_cache_invalidate.
+ *
  */
 //" *RESUME-FORMATTING*"
 #pragma once
@@ -147,6 +164,12 @@ extern "C" {
 /** Requested feature is not supported by this IP version. */
 #define MTB_HAL_MEMORYSPI_RSLT_ERR_UNSUPPORTED                 \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_MEMORYSPI, 6))
+/** Invalid argument or cache configuration. */
+#define MTB_HAL_MEMORYSPI_RSLT_ERR_BAD_ARGUMENT                \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_MEMORYSPI, 7))
+/** A command batch is in progress. */
+#define MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY                        \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_MEMORYSPI, 8))
 
 /**
  * \}
@@ -176,7 +199,8 @@ typedef enum
 {
     MTB_HAL_MEMORYSPI_EVENT_NONE           = 0,            /**< No event */
     MTB_HAL_MEMORYSPI_IRQ_TRANSMIT_DONE    = 1 << 0,       /**< Async transmit done */
-    MTB_HAL_MEMORYSPI_IRQ_RECEIVE_DONE     = 1 << 1        /**< Async receive done */
+    MTB_HAL_MEMORYSPI_IRQ_RECEIVE_DONE     = 1 << 1,       /**< Async receive done */
+    MTB_HAL_MEMORYSPI_IRQ_BATCH_DONE       = 1 << 2        /**< Command batch finished */
 } mtb_hal_memoryspi_event_t;
 
 /** MemorySPI data rate */
@@ -267,6 +291,66 @@ typedef enum
     MTB_HAL_MEMORYSPI_DATA_SELECT_3      = 3
 } mtb_hal_memoryspi_data_select_t;
 
+/** Kind of a command batch step */
+typedef enum
+{
+    MTB_HAL_MEMORYSPI_BATCH_COMMAND        = 0,  /**< Command without data (e.g. write enable) */
+    MTB_HAL_MEMORYSPI_BATCH_WRITE          = 1,  /**< Command followed by TX data */
+    MTB_HAL_MEMORYSPI_BATCH_READ           = 2,  /**< Command followed by RX data */
+    /** Command followed by one RX byte, repeated until the byte matches
+     * (e.g. read status register until write-in-progress clears) */
+    MTB_HAL_MEMORYSPI_BATCH_POLL           = 3
+} mtb_hal_memoryspi_batch_op_t;
+
+/** @brief MemorySPI command batch step, see \ref mtb_hal_memoryspi_batch_start */
+typedef struct mtb_hal_memoryspi_batch_step
+{
+    mtb_hal_memoryspi_batch_op_t        op;          /**< Kind of step */
+    const mtb_hal_memoryspi_command_t*  command;     /**< Command to send */
+    uint32_t                            address;     /**< Address, if the command has one */
+    void*                               data;        /**< TX/RX buffer for write/read steps */
+    size_t                              length;      /**< Length of data in bytes, not 0 for
+                                                        write/read steps */
+    uint8_t                             poll_mask;   /**< Poll: bits of the RX byte to check */
+    uint8_t                             poll_value;  /**< Poll: expected value of those bits */
+    uint32_t                            poll_max;    /**< Poll: maximum number of reads, 0 for no
+                                                        limit */
+} mtb_hal_memoryspi_batch_step_t;
+
+/** Number of uint32_t words of line metadata needed by a read cache with the given geometry */
+#define MTB_HAL_MEMORYSPI_CACHE_TAG_WORDS(num_sets, ways)               \
+    (2UL * (uint32_t)(num_sets) * (uint32_t)(ways))
+
+/** Number of data bytes needed by a read cache with the given geometry */
+#define MTB_HAL_MEMORYSPI_CACHE_DATA_BYTES(line_size, num_sets, ways)   \
+    ((uint32_t)(line_size) * (uint32_t)(num_sets) * (uint32_t)(ways))
+
+/** MemorySPI read cache configuration, see \ref mtb_hal_memoryspi_cache_enable */
+typedef struct
+{
+    /** Command used to fill cache lines. Must have an address phase and stay valid while the cache
+     * is enabled. */
+    const mtb_hal_memoryspi_command_t* read_command;
+    /** Line data, \ref MTB_HAL_MEMORYSPI_CACHE_DATA_BYTES bytes */
+    uint8_t*                        storage;
+    /** Line metadata, \ref MTB_HAL_MEMORYSPI_CACHE_TAG_WORDS words */
+    uint32_t*                       tags;
+    uint32_t                        line_size;  /**< Bytes per line, power of 2 from 4 to 65536 */
+    uint32_t                        num_sets;   /**< Number of sets, power of 2 */
+    uint8_t                         ways;       /**< Lines per set */
+    bool                            prefetch;   /**< Prefetch the next line of sequential reads */
+} mtb_hal_memoryspi_cache_config_t;
+
+/** MemorySPI read cache counters, see \ref mtb_hal_memoryspi_cache_get_stats */
+typedef struct
+{
+    uint32_t                        hits;          /**< Line lookups served from the cache */
+    uint32_t                        misses;        /**< Line lookups that read the memory */
+    uint32_t                        prefetches;    /**< Background line fills started */
+    uint32_t                        prefetch_hits; /**< Prefetched lines that were used */
+    uint32_t                        invalidations; /**< Lines dropped because of writes */
+} mtb_hal_memoryspi_cache_stats_t;
+
 /** Handler for MemorySPI callbacks */
 typedef void (* mtb_hal_memoryspi_event_callback_t)(void* callback_arg,
                                                     mtb_hal_memoryspi_event_t event);
@@ -359,7 +443,8 @@ cy_rslt_t mtb_hal_memoryspi_read(mtb_hal_memoryspi_t* obj,
  * @param[in]  address  Address to access to
  * @param[out] data     RX buffer
  * @param[in]  length   RX buffer length in bytes
- * @return The status of the read request
+ * @return The status of the read request, \ref MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY while a command
+ * batch is in progress
  */
 cy_rslt_t mtb_hal_memoryspi_read_async(mtb_hal_memoryspi_t* obj,
                                        const mtb_hal_memoryspi_command_t* command,
@@ -402,7 +487,8 @@ cy_rslt_t mtb_hal_memoryspi_write(mtb_hal_memoryspi_t* obj,
  * @param[in] address  Address to access to
  * @param[in] data     TX buffer
  * @param[in] length   TX buffer length in bytes
- * @return The status of the write request
+ * @return The status of the write request, \ref MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY while a command
+ * batch is in progress
  */
 cy_rslt_t mtb_hal_memoryspi_write_async(mtb_hal_memoryspi_t* obj,
                                         const mtb_hal_memoryspi_command_t* command,
@@ -419,7 +505,8 @@ cy_rslt_t mtb_hal_memoryspi_write_async(mtb_hal_memoryspi_t* obj,
  * @param[in]  tx_size  TX buffer length in bytes
  * @param[out] rx_data  RX buffer
  * @param[in]  rx_size  RX buffer length in bytes
- * @return The status of the transfer request
+ * @return The status of the transfer request, \ref MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY while a
+ * command batch is in progress
  */
 cy_rslt_t mtb_hal_memoryspi_transfer(
     mtb_hal_memoryspi_t* obj, const mtb_hal_memoryspi_command_t* command, uint32_t address,
@@ -474,6 +561,115 @@ bool mtb_hal_memoryspi_is_async_in_progress(mtb_hal_memoryspi_t* obj);
  */
 bool mtb_hal_memoryspi_is_busy(mtb_hal_memoryspi_t* obj);
 
+/** Starts a command batch.
+ *
+ * The steps are pushed through the SMIF command FIFO back-to-back: command-only steps are queued
+ * immediately and each data phase continues the batch from its completion interrupt, so a whole
+ * write enable / page program / status poll sequence runs without CPU involvement between the
+ * steps. Completion is reported with the @ref MTB_HAL_MEMORYSPI_IRQ_BATCH_DONE event, the outcome
+ * with \ref mtb_hal_memoryspi_get_batch_result. A poll step that exceeds its poll_max reads ends
+ * the batch with \ref MTB_HAL_MEMORYSPI_RSLT_ERR_TIMEOUT. Reads of a poll step are spaced by the
+ * timer set with \ref mtb_hal_memoryspi_batch_set_poll_timer; without one, a status that does
+ * not match is read again straight from the completion interrupt. Step completions are not
+ * reported as transmit/receive done events.
+ * While the batch is in progress it owns the bus: \ref mtb_hal_memoryspi_read_async,
+ * \ref mtb_hal_memoryspi_write_async and \ref mtb_hal_memoryspi_transfer return
+ * \ref MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY. Interrupts stay enabled while steps are queued and the
+ * @ref MTB_HAL_MEMORYSPI_IRQ_BATCH_DONE event is raised from the context that ends the batch,
+ * which is this function if the batch ends before a data phase is started.
+ * This requires \ref mtb_hal_memoryspi_process_interrupt to be called from the SMIF interrupt
+ * handler. The steps and their buffers must stay valid until the batch finishes.
+ *
+ * @param[in] obj           The MemorySPI object
+ * @param[in] steps         Steps to execute in order
+ * @param[in] count         Number of steps
+ * @return The status of the request, \ref MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY while a batch is in
+ * progress or a read cache prefetch is still on the bus
+ */
+cy_rslt_t mtb_hal_memoryspi_batch_start(mtb_hal_memoryspi_t* obj,
+                                        const mtb_hal_memoryspi_batch_step_t* steps,
+                                        uint32_t count);
+
+#if defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+/** Sets the timer that spaces the status reads of command batch poll steps.
+ *
+ * When a poll step reads a status that does not match, the timer is reset and started, and the
+ * step is issued again from its terminal count event. The timer period, as set up by the
+ * configurator, is therefore the poll interval; it should be one-shot or is stopped by the
+ * MemorySPI driver on terminal count. The MemorySPI driver registers its own timer callback and
+ * enables the terminal count event, so the timer must not be used for anything else until it is
+ * released by passing NULL. This requires \ref mtb_hal_timer_process_interrupt to be called from
+ * the timer interrupt handler.
+ *
+ * @param[in] obj           The MemorySPI object
+ * @param[in] timer         Timer to use, or NULL to read again without delay
+ * @return The status of the request, \ref MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY while a batch is in
+ * progress
+ */
+cy_rslt_t mtb_hal_memoryspi_batch_set_poll_timer(mtb_hal_memoryspi_t* obj, mtb_hal_timer_t* timer);
+
+#endif /* defined(MTB_HAL_DRIVER_AVAILABLE_TIMER) */
+
+/** Checks if a command batch is in progress
+ *
+ * @param[in] obj           The MemorySPI object
+ * @return Indication of whether a command batch is in progress
+ */
+bool mtb_hal_memoryspi_is_batch_in_progress(mtb_hal_memoryspi_t* obj);
+
+/** Result of the last command batch, valid once it is no longer in progress
+ *
+ * @param[in] obj           The MemorySPI object
+ * @return The status of the last batch
+ */
+cy_rslt_t mtb_hal_memoryspi_get_batch_result(mtb_hal_memoryspi_t* obj);
+
+/** Enables the read cache, see \ref subsection_memoryspi_read_cache.
+ *
+ * The cache starts empty and its counters are cleared.
+ *
+ * @param[in] obj           The MemorySPI object
+ * @param[in] config        Cache geometry and storage, owned by the application until
+ *                          \ref mtb_hal_memoryspi_cache_disable is called
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_memoryspi_cache_enable(mtb_hal_memoryspi_t* obj,
+                                         const mtb_hal_memoryspi_cache_config_t* config);
+
+/** Disables the read cache, waiting for an outstanding prefetch to finish.
+ *
+ * @param[in] obj           The MemorySPI object
+ */
+void mtb_hal_memoryspi_cache_disable(mtb_hal_memoryspi_t* obj);
+
+/** Reads through the read cache using the configured read command.
+ *
+ * @param[in]  obj          The MemorySPI object
+ * @param[in]  address      Address to read from
+ * @param[out] data         RX buffer
+ * @param[in]  length       Number of bytes to read
+ * @return The status of the read request
+ */
+cy_rslt_t mtb_hal_memoryspi_cache_read(mtb_hal_memoryspi_t* obj, uint32_t address, void* data,
+                                       size_t length);
+
+/** Drops cached lines overlapping the given range.
+ *
+ * @param[in] obj           The MemorySPI object
+ * @param[in] address       Start of the range
+ * @param[in] length        Length of the range in bytes, 0 to drop every line
+ */
+void mtb_hal_memoryspi_cache_invalidate(mtb_hal_memoryspi_t* obj, uint32_t address, size_t length);
+
+/** Reads the read cache counters.
+ *
+ * @param[in]  obj          The MemorySPI object
+ * @param[out] stats        Counters
+ * @param[in]  reset        Clear the counters after reading them
+ */
+void mtb_hal_memoryspi_cache_get_stats(mtb_hal_memoryspi_t* obj,
+                                       mtb_hal_memoryspi_cache_stats_t* stats, bool reset);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,249 @@
+/***************************************************************************//**
+* \file mtb_hal_perf.h
+*
+* \brief
+* Provides optional instrumentation for the HAL drivers: per-instance performance
+* counters and an event trace ring with cycle-count timestamps.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024-2025 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * \addtogroup group_hal_perf Performance Instrumentation
+ * \ingroup group_hal
+ * \{
+ * Optional instrumentation of the HAL drivers.
+ *
+ * Instrumentation is compiled in only when \ref MTB_HAL_PERF_ENABLE is defined. When it is not
+ * defined, the hooks in the drivers expand to nothing, the driver objects carry no extra state,
+ * and none of the functions in this section are available. The instrumentation times everything
+ * with the DWT cycle counter and therefore cannot be enabled on CM0+, which has none.
+ *
+ * \section subsection_perf_features Features
+ * * Per-instance counters of bytes, transfers, errors, retries and busy-wait time
+ * * Interrupt service time and completion latency, measured with the DWT cycle counter
+ * * A lock-free event trace ring shared by all drivers, readable at runtime
+ *
+ * \section subsection_perf_counters Counters
+ * The UART, SDIO and DMA objects each embed a \ref mtb_hal_perf_counters_t. Use
+ * \ref MTB_HAL_PERF_COUNTERS to locate it and \ref mtb_hal_perf_read_counters to take a
+ * consistent snapshot. Counters that thread context and interrupt handlers both update are
+ * changed inside a critical section; a snapshot taken with \ref mtb_hal_perf_read_counters is
+ * consistent with respect to the interrupt handlers.
+ *
+ * \section subsection_perf_trace Trace Ring
+ * The trace ring is backed by application-provided storage whose number of entries must be a
+ * power of two. Drivers record events from both thread and interrupt context; a slot is reserved
+ * with an exclusive-access increment so recording never blocks and never disables interrupts.
+ * When the ring wraps, the oldest entries are overwritten. A single reader drains the ring with
+ * \ref mtb_hal_perf_trace_read, which reports how many entries were overwritten before they
+ * could be read.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_pdl.h"
+#include "cy_result.h"
+#include "mtb_hal_general_types.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#if defined(DOXYGEN)
+/** Define this macro to compile the instrumentation into the HAL drivers. */
+#define MTB_HAL_PERF_ENABLE
+#endif
+
+#if defined(MTB_HAL_PERF_ENABLE)
+
+#if (CY_CPU_CORTEX_M0P)
+#error "MTB_HAL_PERF_ENABLE requires the DWT cycle counter, which CM0+ does not have"
+#endif
+
+/** \addtogroup group_hal_results_perf Performance Instrumentation HAL Results
+ *  Performance instrumentation specific return codes
+ *  \ingroup group_hal_results
+ *  \{ *//**
+ */
+
+/** An invalid argument was passed to a function. */
+#define MTB_HAL_PERF_RSLT_ERR_BAD_ARGUMENT                \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_PERF, 0))
+
+/**
+ * \}
+ */
+
+/** Returns a pointer to the \ref mtb_hal_perf_counters_t embedded in a driver object */
+#define MTB_HAL_PERF_COUNTERS(obj)          (&((obj)->perf))
+
+/** Per-instance performance counters */
+typedef struct
+{
+    uint32_t    bytes;                  //!< Bytes transferred
+    uint32_t    transfers;              //!< Transfers started
+    uint32_t    errors;                 //!< Transfers or interrupts that reported an error
+    uint32_t    retries;                //!< Transfer attempts that had to be repeated
+    uint32_t    busy_wait_us;           //!< Time spent polling for the hardware, in microseconds
+    uint32_t    isr_count;              //!< Interrupts serviced
+    uint32_t    isr_cycles_max;         //!< Longest interrupt service time, in CPU cycles
+    uint64_t    isr_cycles_total;       //!< Sum of interrupt service times, in CPU cycles
+    uint32_t    latency_cycles_last;    //!< Start-to-completion time of the last transfer
+    uint32_t    latency_cycles_max;     //!< Longest start-to-completion time observed
+} mtb_hal_perf_counters_t;
+
+/** Trace events recorded by the drivers */
+typedef enum
+{
+    MTB_HAL_PERF_EVENT_ISR_ENTER    = 0, //!< Interrupt handler entered. arg: pending causes
+    MTB_HAL_PERF_EVENT_ISR_EXIT     = 1, //!< Interrupt handler left. arg: cycles spent
+    MTB_HAL_PERF_EVENT_XFER_START   = 2, //!< Transfer started. arg: length in bytes
+    MTB_HAL_PERF_EVENT_XFER_DONE    = 3, //!< Transfer completed. arg: start-to-completion cycles
+    MTB_HAL_PERF_EVENT_ERROR        = 4, //!< Error reported. arg: driver-specific cause
+    MTB_HAL_PERF_EVENT_RETRY        = 5, //!< Transfer attempt repeated. arg: attempts left
+    MTB_HAL_PERF_EVENT_WAIT         = 6  //!< Busy-wait finished. arg: microseconds polled
+} mtb_hal_perf_event_t;
+
+/** One entry of the trace ring */
+typedef struct
+{
+    volatile uint32_t   sequence;   //!< Internal: index of the entry plus one once it is complete
+    uint32_t            cycles;     //!< DWT cycle count when the event was recorded
+    const void*         instance;   //!< Driver object that recorded the event
+    uint32_t            arg;        //!< Event-specific value, see \ref mtb_hal_perf_event_t
+    uint8_t             module;     //!< Recording driver, one of the MTB_HAL_RSLT_MODULE_ values
+    uint8_t             event;      //!< Event kind, a \ref mtb_hal_perf_event_t
+} mtb_hal_perf_trace_entry_t;
+
+/** Returns the current value of the DWT cycle counter.
+ *
+ * The counter is enabled by \ref mtb_hal_perf_trace_start or \ref mtb_hal_perf_enable_cycles.
+ *
+ * @return The cycle count
+ */
+static inline uint32_t mtb_hal_perf_get_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+
+/** Enables the DWT cycle counter used for all timing measurements.
+ *
+ * Call this before using the drivers if timing counters are needed without a trace ring.
+ */
+void mtb_hal_perf_enable_cycles(void);
+
+/** Takes a snapshot of a counters block and optionally clears it.
+ *
+ * @param[in,out] counters The counters to read, see \ref MTB_HAL_PERF_COUNTERS
+ * @param[out]    snapshot Location to copy the counters to
+ * @param[in]     reset    Whether to clear the counters after copying them
+ */
+void mtb_hal_perf_read_counters(mtb_hal_perf_counters_t* counters,
+                                mtb_hal_perf_counters_t* snapshot, bool reset);
+
+/** Starts recording driver events into a trace ring.
+ *
+ * Any previously started ring is discarded. The cycle counter is enabled.
+ *
+ * @param[in] storage Entries backing the ring
+ * @param[in] size    Number of entries in storage; must be a power of two
+ * @return The status of the start request
+ */
+cy_rslt_t mtb_hal_perf_trace_start(mtb_hal_perf_trace_entry_t* storage, uint32_t size);
+
+/** Stops recording driver events. Entries already recorded can no longer be read. */
+void mtb_hal_perf_trace_stop(void);
+
+/** Copies the oldest unread entries out of the trace ring.
+ *
+ * Must only be called from one context at a time.
+ *
+ * @param[out] entries Location to copy the entries to
+ * @param[in]  count   Maximum number of entries to copy
+ * @param[out] lost    Number of entries overwritten before they could be read. May be NULL.
+ * @return The number of entries copied
+ */
+uint32_t mtb_hal_perf_trace_read(mtb_hal_perf_trace_entry_t* entries, uint32_t count,
+                                 uint32_t* lost);
+
+/** \cond INTERNAL */
+
+/** Adds to a counter that thread context and interrupt handlers both update */
+void _mtb_hal_perf_add(uint32_t* counter, uint32_t value);
+
+/** Records one event in the trace ring, if a ring is started */
+void _mtb_hal_perf_trace_record(uint8_t module, mtb_hal_perf_event_t event, const void* instance,
+                                uint32_t arg);
+
+/** Records the end of an interrupt handler that started at the given cycle count */
+void _mtb_hal_perf_isr_exit(uint8_t module, const void* instance,
+                            mtb_hal_perf_counters_t* counters, uint32_t start);
+
+/** Records a transfer completion that started at the given cycle count */
+void _mtb_hal_perf_complete(uint8_t module, const void* instance,
+                            mtb_hal_perf_counters_t* counters, uint32_t start, uint32_t bytes);
+
+/** Converts a number of CPU cycles to microseconds */
+#define _MTB_HAL_PERF_CYCLES_TO_US(cycles) \
+    ((uint32_t)(((uint64_t)(cycles) * 1000000ULL) / SystemCoreClock))
+
+#define _MTB_HAL_PERF_ADD(obj, counter, value) \
+    _mtb_hal_perf_add(&((obj)->perf.counter), (uint32_t)(value))
+#define _MTB_HAL_PERF_TRACE(module, event, instance, arg) \
+    _mtb_hal_perf_trace_record((uint8_t)(module), (event), (instance), (uint32_t)(arg))
+/* Declares a local holding the start cycle count; pair with _MTB_HAL_PERF_ISR_EXIT in the same
+   scope. */
+#define _MTB_HAL_PERF_ISR_ENTER(module, obj, arg) \
+    uint32_t _mtb_hal_perf_isr_start = mtb_hal_perf_get_cycles(); \
+    _MTB_HAL_PERF_TRACE((module), MTB_HAL_PERF_EVENT_ISR_ENTER, (obj), (arg))
+#define _MTB_HAL_PERF_ISR_EXIT(module, obj) \
+    _mtb_hal_perf_isr_exit((uint8_t)(module), (obj), &((obj)->perf), _mtb_hal_perf_isr_start)
+/* Declares a local holding the start cycle count; pair with _MTB_HAL_PERF_BUSY_END in the same
+   scope. */
+#define _MTB_HAL_PERF_BUSY_BEGIN() \
+    uint32_t _mtb_hal_perf_busy_start = mtb_hal_perf_get_cycles()
+#define _MTB_HAL_PERF_BUSY_END(obj) \
+    _MTB_HAL_PERF_ADD((obj), busy_wait_us, \
+                      _MTB_HAL_PERF_CYCLES_TO_US(mtb_hal_perf_get_cycles() - _mtb_hal_perf_busy_start))
+
+/** \endcond */
+
+#else // !defined(MTB_HAL_PERF_ENABLE)
+
+/** \cond INTERNAL */
+#define _MTB_HAL_PERF_ADD(obj, counter, value)
+#define _MTB_HAL_PERF_TRACE(module, event, instance, arg)
+#define _MTB_HAL_PERF_ISR_ENTER(module, obj, arg)
+#define _MTB_HAL_PERF_ISR_EXIT(module, obj)
+#define _MTB_HAL_PERF_BUSY_BEGIN()
+#define _MTB_HAL_PERF_BUSY_END(obj)
+/** \endcond */
+
+#endif // defined(MTB_HAL_PERF_ENABLE)
+
+#if defined(__cplusplus)
+}
+#endif
+
+/** \} group_hal_perf */
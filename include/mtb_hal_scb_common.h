@@ -0,0 +1,99 @@
+/***************************************************************************//**
+* \file mtb_hal_scb_common.h
+*
+* \brief
+* Provides the per-instance dispatch of PDL SCB callbacks to the HAL object that
+* owns each SCB block. Shared by the UART, SPI and I2C drivers.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024-2025 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/** \cond INTERNAL */
+
+#pragma once
+
+#include "cy_pdl.h"
+
+#if defined(CY_IP_MXSCB) || defined(CY_IP_MXS22SCB)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+
+/*******************************************************************************
+*                           Defines
+*******************************************************************************/
+
+/* Number of SCB blocks that can have a HAL object bound to them */
+#if defined(CY_IP_MXSCB_INSTANCES)
+#define _MTB_HAL_SCB_INSTANCES              (CY_IP_MXSCB_INSTANCES)
+#elif defined(CY_IP_MXS22SCB_INSTANCES)
+#define _MTB_HAL_SCB_INSTANCES              (CY_IP_MXS22SCB_INSTANCES)
+#else
+#define _MTB_HAL_SCB_INSTANCES              (16u)
+#endif
+
+
+/*******************************************************************************
+*                           Typedefs
+*******************************************************************************/
+
+/** PDL event callback. Matches the UART, SPI and I2C PDL event callback types. */
+typedef void (* _mtb_hal_scb_pdl_event_cb_t)(uint32_t event);
+
+/** PDL I2C address callback */
+typedef cy_en_scb_i2c_command_t (* _mtb_hal_scb_pdl_addr_cb_t)(uint32_t event);
+
+/** Driver handler for a PDL event, called with the object bound to the SCB */
+typedef void (* _mtb_hal_scb_event_handler_t)(void* obj, uint32_t event);
+
+/** Driver handler for a PDL I2C address event, called with the object bound to the SCB */
+typedef cy_en_scb_i2c_command_t (* _mtb_hal_scb_addr_handler_t)(void* obj, uint32_t event);
+
+
+/*******************************************************************************
+*                        Public Function Prototypes
+*******************************************************************************/
+
+/** Return the index of an SCB block */
+uint32_t _mtb_hal_scb_get_block_index(const CySCB_Type* base);
+
+/** Bind an object and its event handler to an SCB block.
+ *
+ * The PDL callbacks carry no context, so each SCB block has its own PDL callback that forwards
+ * to the handler with the bound object. The returned callback must be registered with the PDL
+ * in place of a driver-wide wrapper.
+ */
+_mtb_hal_scb_pdl_event_cb_t _mtb_hal_scb_bind_event(const CySCB_Type* base, void* obj,
+                                                    _mtb_hal_scb_event_handler_t handler);
+
+/** Bind an object and its I2C address handler to an SCB block. See \ref _mtb_hal_scb_bind_event */
+_mtb_hal_scb_pdl_addr_cb_t _mtb_hal_scb_bind_addr(const CySCB_Type* base, void* obj,
+                                                  _mtb_hal_scb_addr_handler_t handler);
+
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
+
+#endif /* defined(CY_IP_MXSCB) || defined(CY_IP_MXS22SCB) */
+
+/** \endcond */
@@ -40,6 +40,7 @@
  * * Supports the 4-bit interface
  * * Supports Ultra High Speed (UHS-I) mode
  * * Supports Default Speed (DS), High Speed (HS), SDR12, SDR25 and SDR50 speed modes
+ * * Supports queued multi-block streaming over scattered buffers, see \ref subsection_sdhc_stream
  *
  * \section subsection_sdhc_quickstart Quick Start
  * Initialize SDHC by using Device Configurator and selecting the pins according to the target
@@ -65,6 +66,18 @@
  * The following snippet writes a block of data to the SD Card. The setup steps from \ref
  * subsection_sdhc_snippet_1 must be followed before writing.
  * \snippet hal_sdhc.c snippet_mtb_hal_sdhc_write_async
+ *
+ * \section subsection_sdhc_stream Streaming
+ * For continuous workloads (e.g. data logging) \ref mtb_hal_sdhc_stream_start switches the driver
+ * into a queued mode. The application submits \ref mtb_hal_sdhc_stream_request_t block ranges,
+ * each of which may be spread over several buffers; the driver turns every request into one
+ * multi-block read/write command backed by a multi-entry ADMA2 descriptor table. Two tables are
+ * used in turn, so the table of the next request is built while the current one is still moving
+ * data and the next command is issued directly from the transfer complete interrupt. This requires
+ * \ref mtb_hal_sdhc_process_interrupt to be called from the SDHC interrupt handler.
+ * Throughput, queue depth and per-command latency counters are available through
+ * \ref mtb_hal_sdhc_stream_get_stats.
+ * Streaming must not be mixed with \ref mtb_hal_sdhc_read_async / \ref mtb_hal_sdhc_write_async.
 
  */
 
@@ -115,6 +128,15 @@ extern "C" {
 /** Cannot make changes in user provided clock configuration or provided clock is incorrect. */
 #define MTB_HAL_SDHC_RSLT_ERR_CLOCK                       \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SDHC, 7))
+/** Streaming request queue is full. */
+#define MTB_HAL_SDHC_RSLT_ERR_STREAM_QUEUE_FULL           \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SDHC, 8))
+/** Streamed transfer could not be issued, failed or was aborted. */
+#define MTB_HAL_SDHC_RSLT_ERR_STREAM_XFER                 \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SDHC, 9))
+/** Operation cannot be performed while a transfer is in progress. */
+#define MTB_HAL_SDHC_RSLT_ERR_BUSY                        \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SDHC, 10))
 
 /**
  * \}
@@ -253,6 +275,10 @@ typedef enum
     MTB_HAL_SDHC_BOOT_ACK_ERR         = 0x1000U
 } mtb_hal_sdhc_error_type_t;
 
+/** Number of uint32_t words needed for the pair of ADMA2 descriptor tables used in streaming
+ * mode, when each request spans at most `max_segments` buffers. */
+#define MTB_HAL_SDHC_STREAM_ADMA_TABLES_WORDS(max_segments)   (4UL * (uint32_t)(max_segments))
+
 /*******************************************************************************
 *       Typedefs
 *******************************************************************************/
@@ -310,6 +336,73 @@ typedef struct
     mtb_hal_sdhc_data_config_t* data_config;
 } mtb_hal_sdhc_cmd_config_t;
 
+/** One buffer of a streaming request */
+typedef struct
+{
+    //! Buffer to read into / write from. Must be 4-byte aligned.
+    uint8_t*                        data;
+    //! Number of 512 byte blocks held by the buffer. A single buffer can hold at most 127 blocks
+    //! (ADMA2 descriptor length limit).
+    uint32_t                        num_blocks;
+} mtb_hal_sdhc_stream_segment_t;
+
+/** Streaming request: a contiguous range of card blocks spread over one or more buffers. The
+ * request and its segments are owned by the application and must stay valid until the driver
+ * sets `complete`. */
+typedef struct mtb_hal_sdhc_stream_request
+{
+    //! Card block address of the first block
+    uint32_t                                address;
+    //! Buffers making up the range, in card order
+    const mtb_hal_sdhc_stream_segment_t*    segments;
+    //! Number of entries in segments
+    uint8_t                                 num_segments;
+    //! true = Write to the card, false = Read from the card.
+    bool                                    write;
+    //! Set by the driver once the request has finished
+    volatile bool                           complete;
+    //! Result of the request, valid once complete is set
+    volatile cy_rslt_t                      result;
+} mtb_hal_sdhc_stream_request_t;
+
+/** Streaming mode configuration, see \ref mtb_hal_sdhc_stream_start */
+typedef struct
+{
+    //! Storage for the request queue
+    mtb_hal_sdhc_stream_request_t** queue;
+    //! Number of entries in queue
+    uint8_t                         queue_size;
+    //! Storage for the ADMA2 descriptor tables. Must hold
+    //! \ref MTB_HAL_SDHC_STREAM_ADMA_TABLES_WORDS(max_segments) words.
+    uint32_t*                       adma_tables;
+    //! Maximum number of segments of a single request
+    uint8_t                         max_segments;
+    //! Optional free running, incrementing tick source used for the latency counters. May be NULL,
+    //! in which case latencies are reported as 0.
+    uint32_t                        (* get_ticks)(void);
+} mtb_hal_sdhc_stream_config_t;
+
+/** Streaming mode counters, see \ref mtb_hal_sdhc_stream_get_stats */
+typedef struct
+{
+    //! Bytes moved by successfully completed requests
+    uint64_t                        bytes_transferred;
+    //! Number of successfully completed requests (one read/write command each)
+    uint32_t                        commands_completed;
+    //! Number of requests completed with an error
+    uint32_t                        errors;
+    //! Number of requests currently queued, including the one on the bus
+    uint32_t                        queue_depth;
+    //! Highest queue depth observed
+    uint32_t                        queue_depth_max;
+    //! Command issue to transfer complete time of the last request, in get_ticks units
+    uint32_t                        latency_last;
+    //! Highest command latency observed, in get_ticks units
+    uint32_t                        latency_max;
+    //! Sum of all command latencies, in get_ticks units
+    uint64_t                        latency_total;
+} mtb_hal_sdhc_stream_stats_t;
+
 /*******************************************************************************
 *       Functions
 *******************************************************************************/
@@ -375,6 +468,49 @@ cy_rslt_t mtb_hal_sdhc_read_async(mtb_hal_sdhc_t* obj, uint32_t address, uint8_t
 cy_rslt_t mtb_hal_sdhc_write_async(mtb_hal_sdhc_t* obj, uint32_t address, const uint8_t* data,
                                    size_t* length);
 
+/** Switches the SDHC into streaming mode, see \ref subsection_sdhc_stream.
+ *
+ * Statistics are reset. No other transfer may be in progress.
+ *
+ * @param[in]  obj                  The SDHC object
+ * @param[in]  config               Queue and descriptor table storage, owned by the application
+ *                                  until \ref mtb_hal_sdhc_stream_stop is called
+ * @return The status of the operation
+ */
+cy_rslt_t mtb_hal_sdhc_stream_start(mtb_hal_sdhc_t* obj, const mtb_hal_sdhc_stream_config_t* config);
+
+/** Queues a streaming request.
+ *
+ * If the bus is idle the command is issued immediately, otherwise it is issued from the transfer
+ * complete interrupt of the preceding request. Completion is signalled through the `complete` and
+ * `result` members of the request.
+ *
+ * @param[in]  obj                  The SDHC object
+ * @param[in]  request              The request to queue
+ * @return The status of the operation. \ref MTB_HAL_SDHC_RSLT_ERR_STREAM_QUEUE_FULL if the queue
+ * has no free entry.
+ */
+cy_rslt_t mtb_hal_sdhc_stream_submit(mtb_hal_sdhc_t* obj, mtb_hal_sdhc_stream_request_t* request);
+
+/** Leaves streaming mode.
+ *
+ * A transfer still in progress is aborted and every pending request is completed with
+ * \ref MTB_HAL_SDHC_RSLT_ERR_STREAM_XFER.
+ *
+ * @param[in]  obj                  The SDHC object
+ * @return The status of the operation
+ */
+cy_rslt_t mtb_hal_sdhc_stream_stop(mtb_hal_sdhc_t* obj);
+
+/** Reads the streaming counters.
+ *
+ * @param[in]  obj                  The SDHC object
+ * @param[out] stats                Counters
+ * @param[in]  reset                Clear the accumulated counters after reading them
+ */
+void mtb_hal_sdhc_stream_get_stats(mtb_hal_sdhc_t* obj, mtb_hal_sdhc_stream_stats_t* stats,
+                                   bool reset);
+
 /** Checks if SD card is inserted
  *
  * @param[in]  obj                  The SDHC peripheral to check
@@ -88,6 +88,33 @@
  * be enabled. A callback function is registered using \ref mtb_hal_spi_register_callback to notify
  * whenever the SPI transfer is complete.
  * \snippet hal_spi.c snippet_mtb_hal_spi_interrupt_callback_events
+ *
+ * \section subsection_spi_dma DMA Transfers
+ * A controller can hand the FIFO handling over to a pair of DMA channels with
+ * \ref mtb_hal_spi_config_dma. Full-duplex transfers (equal TX and RX length, both buffers
+ * provided) are then moved entirely by DMA and complete from the RX DMA interrupt; all other
+ * transfers keep using the interrupt-driven FIFO handling.
+ *
+ * \section subsection_spi_target_stream Target Streaming
+ * A target with DMA channels configured by \ref mtb_hal_spi_config_dma can receive back-to-back
+ * frames without the CPU moving any data with \ref mtb_hal_spi_target_stream_start. The RX
+ * channel writes each frame into one of two application buffers, alternating between them. The
+ * end of a frame is detected on the rising edge of the target select line, monitored through a
+ * GPIO object; the pin can stay connected to the SCB since the port interrupt only observes its
+ * input. At that point the channel is re-armed on the other buffer and the finished buffer is
+ * handed to the application, which owns it until the next frame ends. Data preloaded with
+ * \ref mtb_hal_spi_target_stream_set_tx is sent by the TX channel from the start of every frame.
+ *
+ * \section subsection_spi_queue Transfer Descriptor Queue
+ * Several devices sharing one SPI block can be served with \ref mtb_hal_spi_xfer_desc_t
+ * descriptors queued by \ref mtb_hal_spi_queue_submit. Each descriptor carries its own target
+ * select line, data width and write fill value, which are applied right before the transfer is
+ * started. The next descriptor is started from interrupt context as soon as the previous transfer
+ * completes, before its completion callback runs. The data width is changed without disabling the
+ * block, which is only possible while both FIFOs are empty and the bus is idle; a descriptor whose
+ * width cannot be applied completes with \ref MTB_HAL_SPI_RSLT_DEVICE_BUSY without being
+ * started. \ref mtb_hal_spi_transfer reports \ref MTB_HAL_SPI_RSLT_DEVICE_BUSY while descriptors
+ * are pending.
 
  * \section subsection_spi_moreinfor More Information
  *
@@ -127,6 +154,21 @@ extern "C" {
 /** Failed to Transfer SPI data */
 #define MTB_HAL_SPI_RSLT_TRANSFER_ERROR                   \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SPI, 2))
+/** Transfer descriptor queue is full */
+#define MTB_HAL_SPI_RSLT_QUEUE_FULL                       \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SPI, 3))
+/** Other operation in progress */
+#define MTB_HAL_SPI_RSLT_DEVICE_BUSY                      \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SPI, 4))
+/** Queued transfer was dropped by \ref mtb_hal_spi_queue_stop */
+#define MTB_HAL_SPI_RSLT_ABORTED                          \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SPI, 5))
+/** Streamed target frame was longer than the receive buffer or could not be received */
+#define MTB_HAL_SPI_RSLT_BUFFER_OVERFLOW                  \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SPI, 6))
+/** Timed out waiting for received frames */
+#define MTB_HAL_SPI_RSLT_TIMEOUT                          \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_SPI, 7))
 
 /**
  * \}
@@ -147,6 +189,46 @@ typedef enum
 /** Handler for SPI interrupts */
 typedef void (* mtb_hal_spi_event_callback_t)(void* callback_arg, mtb_hal_spi_event_t event);
 
+/** Handler for completion of a queued SPI transfer, see \ref mtb_hal_spi_queue_submit */
+typedef void (* mtb_hal_spi_xfer_callback_t)(void* callback_arg, struct mtb_hal_spi_xfer_desc* desc);
+
+/** Queued SPI controller transfer. Buffer sizes are in bytes and follow the same rules as
+ * \ref mtb_hal_spi_transfer for the selected data width. The descriptor and its buffers are owned
+ * by the application and must stay valid until the driver sets `complete`. */
+typedef struct mtb_hal_spi_xfer_desc
+{
+    //! Target select line (0 - 3) driven during the transfer
+    uint8_t                             target_select;
+    //! Data width in bits, 0 keeps the current width. Widths above 8 bits require the block to be
+    //! configured with a width above 8 bits. A change is only applied with both FIFOs empty and
+    //! the bus idle, see \ref subsection_spi_queue.
+    uint8_t                             data_bits;
+    //! Value transmitted while receiving more than is written
+    uint8_t                             write_fill;
+    //! Data to write, may be NULL when tx_length is 0
+    const uint8_t*                      tx;
+    //! Number of bytes to write
+    size_t                              tx_length;
+    //! Buffer for the received data, may be NULL when rx_length is 0
+    uint8_t*                            rx;
+    //! Number of bytes to read
+    size_t                              rx_length;
+    //! Called from interrupt context once the transfer has finished, may be NULL
+    mtb_hal_spi_xfer_callback_t         callback;
+    //! Generic argument that will be provided to the callback when called
+    void*                               callback_arg;
+    //! Set by the driver once the transfer has finished
+    volatile bool                       complete;
+    //! Result of the transfer, valid once complete is set
+    volatile cy_rslt_t                  result;
+} mtb_hal_spi_xfer_desc_t;
+
+/** Handler for a frame received by a streaming target, see \ref mtb_hal_spi_target_stream_start.
+ * `length` is the number of bytes received into `rx`. On \ref MTB_HAL_SPI_RSLT_BUFFER_OVERFLOW the
+ * buffer holds the start of the frame and the rest was dropped. */
+typedef void (* mtb_hal_spi_target_frame_callback_t)(void* callback_arg, uint8_t* rx,
+                                                     size_t length, cy_rslt_t status);
+
 /** SPI FIFO type */
 typedef enum
 {
@@ -205,6 +287,33 @@ cy_rslt_t mtb_hal_spi_get(mtb_hal_spi_t* obj, uint32_t* value);
  */
 cy_rslt_t mtb_hal_spi_put(mtb_hal_spi_t* obj, uint32_t value);
 
+/** Synchronously exchange an array of frames, keeping the TX FIFO filled between frames
+ *
+ * Unlike repeated calls to \ref mtb_hal_spi_put and \ref mtb_hal_spi_get, the FIFOs are not
+ * cleared and the bus is not drained between frames, so frames go out back to back. The frames
+ * are held in elements of the width needed by the configured data width: uint8_t up to 8 bits,
+ * uint16_t up to 16 bits and uint32_t above. The routine for the width is selected when the data
+ * width is set, not on each call. The call polls and does not use interrupts, and is only
+ * available in controller mode.
+ *
+ * A lost frame (RX FIFO overflow) or an out of range FIFO access ends the exchange with
+ * \ref MTB_HAL_SPI_RSLT_TRANSFER_ERROR; waiting longer than the timeout for received frames ends
+ * it with \ref MTB_HAL_SPI_RSLT_TIMEOUT. In both cases the FIFOs are cleared.
+ *
+ * @param[in]  obj        The SPI object
+ * @param[in]  tx         Frames to send, or NULL to send write_fill. Aligned to the element size.
+ * @param[out] rx         Buffer for the received frames, or NULL to drop them. Aligned to the
+ *                        element size.
+ * @param[in]  count      Number of frames to exchange, not 0
+ * @param[in]  write_fill Value sent when tx is NULL
+ * @param[in]  timeout    Time in milliseconds to wait for received frames in total, 0 to wait
+ *                        without limit
+ * @return The status of the put_get_array request. \ref MTB_HAL_SPI_RSLT_BAD_ARGUMENT in target
+ * mode, for a count of 0, when both tx and rx are NULL or when a buffer is misaligned.
+ */
+cy_rslt_t mtb_hal_spi_put_get_array(mtb_hal_spi_t* obj, const void* tx, void* rx, size_t count,
+                                    uint32_t write_fill, uint32_t timeout);
+
 /** Write data from the user-defined buffer to the controller TX FIFO.
  * Performs non-blocking controller-mode transfer of an array of data.
  * NOTE: If the size of the actual data is less than the expected, the function will copy only the
@@ -254,7 +363,9 @@ cy_rslt_t mtb_hal_spi_target_write(mtb_hal_spi_t* obj, const uint8_t* src_buff,
  * and rx_length. The bytes written will be padded (at the end) with the value
  * given by write_fill. Using this function will block for the duration of the transfer.
  * The user needs to provide the interrupt handler and call \ref mtb_hal_spi_process_interrupt to
- * process the interrupt.
+ * process the interrupt. In an RTOS aware environment (COMPONENTS+=RTOS_AWARE or
+ * DEFINES+=CY_RTOS_AWARE) the calling task sleeps on a semaphore until the interrupt handler
+ * reports completion, so other tasks can run during long transfers.
  *
  * @param[in] obj           The SPI peripheral to use for sending
  * @param[in] tx            Pointer to the byte-array of data to write to the device
@@ -268,6 +379,136 @@ cy_rslt_t mtb_hal_spi_target_write(mtb_hal_spi_t* obj, const uint8_t* src_buff,
 cy_rslt_t mtb_hal_spi_transfer(mtb_hal_spi_t* obj, const uint8_t* tx, size_t tx_length, uint8_t* rx,
                                size_t rx_length, uint8_t write_fill);
 
+/** Start a transfer without waiting for it to complete
+ *
+ * Buffer sizes follow the same rules as \ref mtb_hal_spi_transfer. The buffers must stay valid
+ * until the transfer completes. Completion is reported with \ref MTB_HAL_SPI_IRQ_DONE to the
+ * callback registered with \ref mtb_hal_spi_register_callback if the event is enabled with
+ * \ref mtb_hal_spi_enable_event; \ref mtb_hal_spi_is_busy can be polled otherwise. The callback
+ * may start the next transfer. The user needs to provide the interrupt handler and call
+ * \ref mtb_hal_spi_process_interrupt to process the interrupt.
+ *
+ * @param[in] obj           The SPI peripheral to use for sending
+ * @param[in] tx            Pointer to the byte-array of data to write to the device
+ * @param[in] tx_length     Number of bytes to write
+ * @param[out] rx           Pointer to the byte-array of data to read from the device
+ * @param[in] rx_length     Number of bytes to read
+ * @param[in] write_fill    Default data transmitted while performing a read
+ * @return The status of the transfer_async request. \ref MTB_HAL_SPI_RSLT_DEVICE_BUSY if
+ * another transfer is in progress.
+ */
+cy_rslt_t mtb_hal_spi_transfer_async(mtb_hal_spi_t* obj, const uint8_t* tx, size_t tx_length,
+                                     uint8_t* rx, size_t rx_length, uint8_t write_fill);
+
+/** Abort a transfer started by \ref mtb_hal_spi_transfer_async. No completion event is raised.
+ *
+ * @param[in] obj           The SPI object
+ * @return The status of the abort_async request
+ */
+cy_rslt_t mtb_hal_spi_abort_async(mtb_hal_spi_t* obj);
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+/** Configure DMA channels for controller transfers, see \ref subsection_spi_dma, and for target
+ * streaming, see \ref subsection_spi_target_stream.
+ *
+ * The channels must be set up by the configurator: TX triggered by the SCB TX FIFO trigger with
+ * incrementing source and fixed destination, RX triggered by the SCB RX FIFO trigger with fixed
+ * source and incrementing destination, one element per trigger and an element size matching the
+ * data width. \ref mtb_hal_dma_process_interrupt must be invoked from the RX DMA interrupt
+ * handler. Pass NULL for both channels to go back to interrupt-driven FIFO handling.
+ *
+ * @param[in] obj               The SPI object
+ * @param[in] dma_rx            DMA object moving data from the SPI RX FIFO to memory
+ * @param[in] dma_tx            DMA object moving data from memory to the SPI TX FIFO
+ * @return The status of the config_dma request
+ */
+cy_rslt_t mtb_hal_spi_config_dma(mtb_hal_spi_t* obj, mtb_hal_dma_t* dma_rx, mtb_hal_dma_t* dma_tx);
+
+/** Start receiving frames by DMA in target mode, see \ref subsection_spi_target_stream.
+ *
+ * The block must be configured as a target and DMA channels must be configured with
+ * \ref mtb_hal_spi_config_dma. The GPIO interrupt of the target select pin must call
+ * \ref mtb_hal_gpio_process_interrupt for `select`; its callback is taken over by the driver.
+ * While streaming, the other transfer functions report \ref MTB_HAL_SPI_RSLT_DEVICE_BUSY.
+ *
+ * @param[in] obj           The SPI object
+ * @param[in] select        GPIO object for the target select pin
+ * @param[in] rx_buffer0    First receive buffer
+ * @param[in] rx_buffer1    Second receive buffer
+ * @param[in] size          Size of each receive buffer in bytes, a multiple of the data width
+ * @param[in] callback      Called from the GPIO interrupt each time a frame ends
+ * @param[in] callback_arg  Generic argument that will be provided to the callback when called
+ * @return The status of the target_stream_start request
+ */
+cy_rslt_t mtb_hal_spi_target_stream_start(mtb_hal_spi_t* obj, mtb_hal_gpio_t* select,
+                                          uint8_t* rx_buffer0, uint8_t* rx_buffer1, size_t size,
+                                          mtb_hal_spi_target_frame_callback_t callback,
+                                          void* callback_arg);
+
+/** Set the data sent by a streaming target from the start of each frame.
+ *
+ * Takes effect from the next frame. When the host clocks out more than `length` bytes, the
+ * SCB default value is sent for the remainder. The buffer must stay valid until it is replaced
+ * or streaming stops.
+ *
+ * @param[in] obj           The SPI object
+ * @param[in] tx            Data to send, NULL to send nothing
+ * @param[in] length        Number of bytes to send, a multiple of the data width
+ * @return The status of the target_stream_set_tx request
+ */
+cy_rslt_t mtb_hal_spi_target_stream_set_tx(mtb_hal_spi_t* obj, const uint8_t* tx, size_t length);
+
+/** Stop receiving frames by DMA. A frame in progress is dropped.
+ *
+ * @param[in] obj           The SPI object
+ * @return The status of the target_stream_stop request
+ */
+cy_rslt_t mtb_hal_spi_target_stream_stop(mtb_hal_spi_t* obj);
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+
+/** Enable the transfer descriptor queue, see \ref subsection_spi_queue.
+ *
+ * The block must be configured as a controller. \ref mtb_hal_spi_process_interrupt must be called
+ * from the SPI interrupt handler.
+ *
+ * @param[in]  obj        The SPI object
+ * @param[in]  storage    Array of `size` descriptor pointers used as the queue, owned by the
+ *                        application until \ref mtb_hal_spi_queue_stop is called
+ * @param[in]  size       Number of entries in storage
+ * @return The status of the queue_start request
+ */
+cy_rslt_t mtb_hal_spi_queue_start(mtb_hal_spi_t* obj, mtb_hal_spi_xfer_desc_t** storage,
+                                  uint8_t size);
+
+/** Queue a transfer descriptor.
+ *
+ * The transfer is started immediately if the bus is idle, otherwise when all previously queued
+ * transfers have finished. May be called from a completion callback.
+ *
+ * @param[in]  obj        The SPI object
+ * @param[in]  desc       The transfer to queue
+ * @return The status of the queue_submit request. \ref MTB_HAL_SPI_RSLT_QUEUE_FULL if all
+ * queue entries are in use.
+ */
+cy_rslt_t mtb_hal_spi_queue_submit(mtb_hal_spi_t* obj, mtb_hal_spi_xfer_desc_t* desc);
+
+/** Returns the number of queued transfers which have not finished yet
+ *
+ * @param[in]  obj        The SPI object
+ * @return The number of pending transfers, including the one on the bus
+ */
+uint32_t mtb_hal_spi_queue_get_count(mtb_hal_spi_t* obj);
+
+/** Disable the transfer descriptor queue.
+ *
+ * The transfer on the bus is aborted. It and all transfers still queued complete with
+ * \ref MTB_HAL_SPI_RSLT_ABORTED.
+ *
+ * @param[in]  obj        The SPI object
+ * @return The status of the queue_stop request
+ */
+cy_rslt_t mtb_hal_spi_queue_stop(mtb_hal_spi_t* obj);
+
 /** Clear the SPI buffers
  *
  * @param[in]  obj        The SPI object
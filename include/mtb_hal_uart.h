@@ -151,6 +151,9 @@ extern "C" {
 /** Other operation in progress */
 #define MTB_HAL_UART_RSLT_ERR_BUSY                         \
     (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_UART, 3))
+/** Bad argument */
+#define MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT                 \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, MTB_HAL_RSLT_MODULE_UART, 4))
 /**
  * \}
  */
@@ -158,6 +161,68 @@ extern "C" {
 #define MTB_HAL_UART_MAX_BAUD_PERCENT_DIFFERENCE 10
 /** The maximum allowable tolerance in PPM on the UART clock frequency **/
 #define MTB_HAL_UART_CLOCK_FREQ_MAX_TOLERANCE_PPM (20000UL)
+/** The lowest oversample factor considered when searching for a baud rate setting **/
+#define MTB_HAL_UART_OVERSAMPLE_MIN               (8UL)
+/** The highest oversample factor considered when searching for a baud rate setting **/
+#define MTB_HAL_UART_OVERSAMPLE_MAX               (16UL)
+
+/** \cond INTERNAL */
+#define _MTB_HAL_UART_ABS_DIFF(a, b)        (((a) > (b)) ? ((a) - (b)) : ((b) - (a)))
+#define _MTB_HAL_UART_MIN(a, b)             (((a) < (b)) ? (a) : (b))
+/* Divider closest to source / (baud * oversample) that a divider with `frac` fraction bits (0 or
+ * 5) can take, always expressed with 5 fraction bits */
+#define _MTB_HAL_UART_BAUD_DIV(src, baud, ovs, frac) \
+    (((((uint64_t)(src) << (frac)) + (((uint64_t)(baud) * (ovs)) / 2U)) / \
+      ((uint64_t)(baud) * (ovs))) << (5U - (frac)))
+/* Baud rate error in PPM obtained with the divider above */
+#define _MTB_HAL_UART_BAUD_ERR(src, baud, ovs, frac) \
+    ((_MTB_HAL_UART_ABS_DIFF((uint64_t)(src) << 5U, \
+                             _MTB_HAL_UART_BAUD_DIV(src, baud, ovs, frac) * (baud) * (ovs)) * \
+      1000000U) / (_MTB_HAL_UART_BAUD_DIV(src, baud, ovs, frac) * (baud) * (ovs)))
+/* Sort key: lowest error first, then highest oversample */
+#define _MTB_HAL_UART_BAUD_KEY(src, baud, ovs, frac) \
+    ((_MTB_HAL_UART_BAUD_ERR(src, baud, ovs, frac) << 5U) | (32U - (ovs)))
+/* Lowest sort key of the oversample factors ovs to ovs + 3 */
+#define _MTB_HAL_UART_BAUD_KEY4(src, baud, ovs, frac) \
+    _MTB_HAL_UART_MIN(_MTB_HAL_UART_MIN(_MTB_HAL_UART_BAUD_KEY(src, baud, (ovs), frac), \
+                                        _MTB_HAL_UART_BAUD_KEY(src, baud, (ovs) + 1U, frac)), \
+                      _MTB_HAL_UART_MIN(_MTB_HAL_UART_BAUD_KEY(src, baud, (ovs) + 2U, frac), \
+                                        _MTB_HAL_UART_BAUD_KEY(src, baud, (ovs) + 3U, frac)))
+#define _MTB_HAL_UART_BAUD_BEST_OVS(src, baud, frac) \
+    (32U - (uint32_t)(_MTB_HAL_UART_MIN( \
+                          _MTB_HAL_UART_MIN(_MTB_HAL_UART_BAUD_KEY4(src, baud, 8U, frac), \
+                                            _MTB_HAL_UART_BAUD_KEY4(src, baud, 12U, frac)), \
+                          _MTB_HAL_UART_BAUD_KEY(src, baud, 16U, frac)) & 31U))
+/** \endcond */
+
+/** Computes a \ref mtb_hal_uart_baud_config_t initializer at compile time.
+ *
+ * Searches oversample factors 8 to 16 for the one whose divider gives the smallest baud rate
+ * error. The divider type of the UART's clock must be given because an integer (8 or 16 bit)
+ * divider cannot take a fraction; \ref mtb_hal_uart_set_baud_config rejects a fractional setting
+ * for it. All arguments must be constant expressions, so a table of the rates an application
+ * switches between costs no run time:
+ *
+ *     static const mtb_hal_uart_baud_config_t rates[] =
+ *     {
+ *         MTB_HAL_UART_BAUD_CONFIG(100000000UL, 115200UL, true),
+ *         MTB_HAL_UART_BAUD_CONFIG(100000000UL, 3686400UL, true),
+ *     };
+ *
+ * @param[in] source_hz     Frequency feeding the UART's peripheral clock divider
+ * @param[in] baudrate      The baud rate
+ * @param[in] fractional    true for a fractional (16.5 or 24.5 bit) divider, false for an integer
+ *                          (8 or 16 bit) divider
+ */
+#define MTB_HAL_UART_BAUD_CONFIG(source_hz, baudrate, fractional)                          \
+    {                                                                                      \
+        .oversample = _MTB_HAL_UART_BAUD_BEST_OVS(source_hz, baudrate,                     \
+                                                  ((fractional) ? 5U : 0U)),               \
+        .divider    = (uint32_t)_MTB_HAL_UART_BAUD_DIV(                                    \
+            source_hz, baudrate,                                                           \
+            _MTB_HAL_UART_BAUD_BEST_OVS(source_hz, baudrate, ((fractional) ? 5U : 0U)),    \
+            ((fractional) ? 5U : 0U))                                                      \
+    }
 
 /*******************************************************************************
 *                           Enums
@@ -186,9 +251,49 @@ typedef enum
     //! Number of entries in the HW TX FIFO is less than the TX FIFO trigger level
     MTB_HAL_UART_IRQ_TX_FIFO             = (MTB_HAL_MAP_UART_IRQ_TX_FIFO),
     //! Number of entries in the HW RX FIFO is more than the RX FIFO trigger level
-    MTB_HAL_UART_IRQ_RX_FIFO             = (MTB_HAL_MAP_UART_IRQ_RX_FIFO)
+    MTB_HAL_UART_IRQ_RX_FIFO             = (MTB_HAL_MAP_UART_IRQ_RX_FIFO),
+    //! The DMA receive ring has been filled up to its half point
+    MTB_HAL_UART_IRQ_RX_RING_HALF        = (MTB_HAL_MAP_UART_IRQ_RX_RING_HALF),
+    //! The DMA receive ring has been filled up to its end and wrapped around
+    MTB_HAL_UART_IRQ_RX_RING_FULL        = (MTB_HAL_MAP_UART_IRQ_RX_RING_FULL),
+    //! Unread data in the DMA receive ring has been overwritten
+    MTB_HAL_UART_IRQ_RX_RING_OVERFLOW    = (MTB_HAL_MAP_UART_IRQ_RX_RING_OVERFLOW),
+    //! No data has arrived since the previous \ref mtb_hal_uart_rx_ring_check_idle call
+    MTB_HAL_UART_IRQ_RX_IDLE             = (MTB_HAL_MAP_UART_IRQ_RX_IDLE),
+    //! Data below the RX FIFO trigger level was released by \ref mtb_hal_uart_check_rx_timeout
+    MTB_HAL_UART_IRQ_RX_TIMEOUT          = (MTB_HAL_MAP_UART_IRQ_RX_TIMEOUT)
 } mtb_hal_uart_event_t;
 
+/** Baud rate setting of a UART clocked from a peripheral clock divider.
+ *
+ * Produced by \ref MTB_HAL_UART_BAUD_CONFIG or \ref mtb_hal_uart_calc_baud_config and applied by
+ * \ref mtb_hal_uart_set_baud_config.
+ */
+typedef struct
+{
+    uint32_t oversample;    //!< UART oversample factor
+    uint32_t divider;       //!< Peripheral clock divider, fixed-point with 5 fraction bits
+} mtb_hal_uart_baud_config_t;
+
+#if defined(COMPONENT_MW_ASYNC_TRANSFER)
+/** Adaptive FIFO trigger level statistics, see \ref mtb_hal_uart_get_fifo_stats */
+typedef struct
+{
+    uint32_t rx_bytes;              //!< Bytes drained from the RX FIFO on level interrupts
+    uint32_t rx_interrupts;         //!< RX level interrupts serviced
+    uint32_t rx_interrupts_per_kib; //!< RX level interrupts per 1024 received bytes
+    uint32_t tx_bytes;              //!< Bytes written to the TX FIFO on level interrupts
+    uint32_t tx_interrupts;         //!< TX level interrupts serviced
+    uint32_t tx_interrupts_per_kib; //!< TX level interrupts per 1024 transmitted bytes
+    uint32_t tx_underruns;          //!< TX level interrupts serviced after the FIFO ran empty
+    uint32_t rx_timeouts;           //!< Times data was held below the trigger level for a full
+                                    //!< timeout check period. Each one adds up to one period of
+                                    //!< latency; this is the cost of a high trigger level.
+    uint32_t rx_timeout_bytes;      //!< Bytes that were released by a receive timeout
+    uint32_t level_changes;         //!< Number of trigger level adjustments
+} mtb_hal_uart_fifo_stats_t;
+#endif /* defined(COMPONENT_MW_ASYNC_TRANSFER) */
+
 /*******************************************************************************
 *                          Function Pointers
 *******************************************************************************/
@@ -200,6 +305,11 @@ typedef void (* mtb_hal_uart_event_callback_t)(void* callback_arg, mtb_hal_uart_
 *                        Public Function Prototypes
 *******************************************************************************/
 /** Configure the baud rate
+ *
+ * When the UART is clocked through \ref mtb_hal_clock_peri_interface and runs in standard mode,
+ * the oversample factor and the peripheral divider are chosen together for the smallest baud
+ * rate error, see \ref mtb_hal_uart_calc_baud_config. Otherwise the configured oversample factor
+ * is kept and only the clock frequency is changed.
  *
  * @param[in,out] obj           The UART object
  * @param[in]     baudrate      The baud rate to be configured
@@ -209,6 +319,39 @@ typedef void (* mtb_hal_uart_event_callback_t)(void* callback_arg, mtb_hal_uart_
  */
 cy_rslt_t mtb_hal_uart_set_baud(mtb_hal_uart_t* obj, uint32_t baudrate, uint32_t* actualbaud);
 
+/** Compute the baud rate setting with the smallest error for the UART's clock.
+ *
+ * In standard mode all oversample factors from \ref MTB_HAL_UART_OVERSAMPLE_MIN to
+ * \ref MTB_HAL_UART_OVERSAMPLE_MAX are tried with the closest divider the clock's divider type
+ * supports; other modes keep the configured oversample factor. Only integer arithmetic is
+ * used. The hardware is not modified, so the result can be stored and applied later with
+ * \ref mtb_hal_uart_set_baud_config.
+ *
+ * @param[in]  obj              The UART object. Its clock must use
+ *                              \ref mtb_hal_clock_peri_interface
+ * @param[in]  baudrate         The baud rate
+ * @param[out] config           The computed setting
+ * @param[out] actualbaud       The baud rate the setting achieves. May be NULL.
+ * @return The status of the request. \ref MTB_HAL_UART_RSLT_ERR_CLOCK_FREQ_TOLERANCE is
+ * returned, with `config` still filled in, if the best setting is further than
+ * \ref MTB_HAL_UART_CLOCK_FREQ_MAX_TOLERANCE_PPM from the requested rate.
+ */
+cy_rslt_t mtb_hal_uart_calc_baud_config(mtb_hal_uart_t* obj, uint32_t baudrate,
+                                        mtb_hal_uart_baud_config_t* config, uint32_t* actualbaud);
+
+/** Apply a precomputed baud rate setting.
+ *
+ * Only the oversample factor and the divider registers are written, so switching between
+ * entries of a table built with \ref MTB_HAL_UART_BAUD_CONFIG involves no search.
+ *
+ * @param[in,out] obj           The UART object. Its clock must use
+ *                              \ref mtb_hal_clock_peri_interface
+ * @param[in]     config        The setting to apply
+ * @return The status of the request
+ */
+cy_rslt_t mtb_hal_uart_set_baud_config(mtb_hal_uart_t* obj,
+                                       const mtb_hal_uart_baud_config_t* config);
+
 /** Get a character. This is a blocking call which waits till a character is received.
  *
  * @param[in] obj               The UART object
@@ -327,6 +470,155 @@ void mtb_hal_uart_register_callback(mtb_hal_uart_t* obj, mtb_hal_uart_event_call
  */
 void mtb_hal_uart_enable_event(mtb_hal_uart_t* obj, mtb_hal_uart_event_t event, bool enable);
 
+/** Start raw FIFO mode
+ *
+ * In raw mode the HAL interrupt handler moves bytes directly between the SCB FIFOs and two
+ * application-provided rings with a minimal register sequence. The PDL UART context and its
+ * interrupt state machine are not used, so \ref mtb_hal_uart_read, \ref mtb_hal_uart_write,
+ * \ref mtb_hal_uart_get, \ref mtb_hal_uart_put, the async transfer functions and the DMA receive
+ * ring must not be used until \ref mtb_hal_uart_raw_stop is called. Data is exchanged with
+ * \ref mtb_hal_uart_raw_write and \ref mtb_hal_uart_raw_read instead.
+ *
+ * The RX FIFO trigger level is set so that every received byte raises an interrupt; each pass
+ * drains whatever has accumulated, so the interrupt rate falls as the byte rate rises.
+ * \ref mtb_hal_uart_process_interrupt must still be invoked from the interrupt handler. The
+ * events delivered in raw mode are:
+ * * \ref MTB_HAL_UART_IRQ_RX_FIFO - new data was placed in the receive ring
+ * * \ref MTB_HAL_UART_IRQ_RX_FULL - received data was dropped because the receive ring was full
+ * * \ref MTB_HAL_UART_IRQ_RX_ERROR - an overflow, frame or parity error was detected
+ * * \ref MTB_HAL_UART_IRQ_TX_TRANSMIT_IN_FIFO - the transmit ring has been moved to the TX FIFO
+ *
+ * @param[in] obj               The UART object
+ * @param[in] rx_buffer         Receive ring storage
+ * @param[in] rx_size           Receive ring size in bytes. Must be a power of two
+ * @param[in] tx_buffer         Transmit ring storage
+ * @param[in] tx_size           Transmit ring size in bytes. Must be a power of two
+ * @return The status of the start request
+ */
+cy_rslt_t mtb_hal_uart_raw_start(mtb_hal_uart_t* obj, uint8_t* rx_buffer, size_t rx_size,
+                                 uint8_t* tx_buffer, size_t tx_size);
+
+/** Stop raw FIFO mode started by \ref mtb_hal_uart_raw_start
+ *
+ * Unsent data in the transmit ring and unread data in the receive ring is discarded. The FIFO
+ * trigger levels and the interrupt masks in use before raw mode was started are restored.
+ *
+ * @param[in] obj               The UART object
+ * @return The status of the stop request
+ */
+cy_rslt_t mtb_hal_uart_raw_stop(mtb_hal_uart_t* obj);
+
+/** Queue data for transmission in raw FIFO mode
+ *
+ * Copies as much of `tx` as fits into the transmit ring. Must not be called from more than one
+ * context at a time.
+ *
+ * @param[in]     obj           The UART object
+ * @param[in]     tx            The data to send
+ * @param[in,out] tx_length     [in] The number of bytes to send, [out] the number queued
+ * @return The status of the write request
+ */
+cy_rslt_t mtb_hal_uart_raw_write(mtb_hal_uart_t* obj, const void* tx, size_t* tx_length);
+
+/** Read received data in raw FIFO mode
+ *
+ * Copies up to `rx_length` bytes out of the receive ring. Must not be called from more than one
+ * context at a time.
+ *
+ * @param[in]     obj           The UART object
+ * @param[out]    rx            The buffer to receive into
+ * @param[in,out] rx_length     [in] The size of `rx`, [out] the number of bytes read
+ * @return The status of the read request
+ */
+cy_rslt_t mtb_hal_uart_raw_read(mtb_hal_uart_t* obj, void* rx, size_t* rx_length);
+
+/** Get the number of bytes waiting in the raw mode receive ring
+ *
+ * @param[in] obj               The UART object
+ * @return The number of unread bytes
+ */
+uint32_t mtb_hal_uart_raw_readable(mtb_hal_uart_t* obj);
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+/** Start continuous DMA reception into a ring buffer
+ *
+ * The DMA channel moves every received byte from the RX FIFO into `buffer` and restarts at the
+ * beginning of the buffer when it reaches the end, so reception never has to be re-armed. The
+ * application consumes the data in place with \ref mtb_hal_uart_rx_ring_get_span and
+ * \ref mtb_hal_uart_rx_ring_release.
+ *
+ * The DMA channel must be configured to be triggered by the UART RX FIFO level trigger with one
+ * element per trigger and a byte element size. To receive the \ref MTB_HAL_UART_IRQ_RX_RING_HALF
+ * event, use a 2D descriptor with the X loop interrupt whose X count divides half of the ring
+ * size. The \ref MTB_HAL_UART_IRQ_RX_RING_FULL event is raised each time the DMA wraps around.
+ * \ref mtb_hal_dma_process_interrupt must be invoked from the DMA interrupt handler.
+ *
+ * While the ring is running, \ref mtb_hal_uart_read and \ref mtb_hal_uart_read_async must
+ * not be used.
+ *
+ * @param[in] obj               The UART object
+ * @param[in] dma_rx            RX DMA object set up for transfer from UART RX FIFO to memory
+ * @param[in] buffer            Ring storage. If D-cache is enabled, the buffer must be aligned
+ *                              to and sized in multiples of the cache line size
+ * @param[in] size              Ring size in bytes. Must be a power of two
+ * @return The status of the start request
+ */
+cy_rslt_t mtb_hal_uart_rx_ring_start(mtb_hal_uart_t* obj, mtb_hal_dma_t* dma_rx, uint8_t* buffer,
+                                     size_t size);
+
+/** Stop continuous DMA reception started by \ref mtb_hal_uart_rx_ring_start
+ *
+ * Restores the RX FIFO trigger level and the DMA channel callback, descriptor chaining and
+ * enabled events that were in place when the ring was started.
+ *
+ * @param[in] obj               The UART object
+ * @return The status of the stop request
+ */
+cy_rslt_t mtb_hal_uart_rx_ring_stop(mtb_hal_uart_t* obj);
+
+/** Get the number of received bytes in the ring that have not been released yet
+ *
+ * @param[in] obj               The UART object
+ * @return The number of unread bytes
+ */
+uint32_t mtb_hal_uart_rx_ring_readable(mtb_hal_uart_t* obj);
+
+/** Get the oldest contiguous span of unread data in the ring
+ *
+ * The data is not copied; `data` points directly into the ring buffer. Because the span ends
+ * at the end of the buffer, a second call after \ref mtb_hal_uart_rx_ring_release may return
+ * more data that wrapped around to the start of the buffer.
+ *
+ * \note If D-cache is enabled, this function invalidates D-cache for the returned span.
+ *
+ * @param[in]  obj              The UART object
+ * @param[out] data             Pointer to the first unread byte
+ * @return The number of bytes available at `data`
+ */
+size_t mtb_hal_uart_rx_ring_get_span(mtb_hal_uart_t* obj, uint8_t** data);
+
+/** Release bytes consumed from the ring so that the DMA can overwrite them
+ *
+ * @param[in] obj               The UART object
+ * @param[in] length            The number of bytes consumed, at most the value returned by
+ *                              \ref mtb_hal_uart_rx_ring_readable. Larger values are
+ *                              clamped to it.
+ */
+void mtb_hal_uart_rx_ring_release(mtb_hal_uart_t* obj, size_t length);
+
+/** Check the receive line for idleness
+ *
+ * The SCB has no receive timeout, so idle line detection is done by calling this function
+ * periodically (for example, from a timer every few character times). The
+ * \ref MTB_HAL_UART_IRQ_RX_IDLE event is raised once when unread data is in the ring and no
+ * new byte has arrived since the previous call.
+ *
+ * @param[in] obj               The UART object
+ * @return True if the line is idle and unread data is waiting in the ring
+ */
+bool mtb_hal_uart_rx_ring_check_idle(mtb_hal_uart_t* obj);
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+
 #if defined(COMPONENT_MW_ASYNC_TRANSFER)
 
 /**Configure the UART async transfer interface for CPU based transfer
@@ -442,6 +734,54 @@ bool mtb_hal_uart_is_async_rx_available(mtb_hal_uart_t* obj);
  */
 bool mtb_hal_uart_is_async_tx_available(mtb_hal_uart_t* obj);
 
+/** Enable or disable adaptive RX/TX FIFO trigger levels for async transfers
+ *
+ * Without adaptation, each async transfer uses the FIFO levels requested by the async transfer
+ * library, which are sized for the transfer and not for the traffic. With adaptation enabled:
+ * * The RX level grows while bytes keep arriving faster than the FIFO is serviced and shrinks
+ *   each time \ref mtb_hal_uart_check_rx_timeout finds data stranded below it. It is capped by
+ *   the headroom the observed arrival rate needs during interrupt latency and by the remaining
+ *   length of the current read.
+ * * The TX level rises when the FIFO is found empty on a refill, and falls otherwise, so each
+ *   refill moves as many bytes as the line rate allows without gaps.
+ *
+ * A high RX level can hold the last bytes of a burst below the trigger level. To avoid stranding
+ * them, \ref mtb_hal_uart_check_rx_timeout must be called periodically while adaptation is
+ * enabled. Adaptation is not used for DMA based async transfers.
+ *
+ * @param[in] obj               The UART object
+ * @param[in] enable            True to tune levels from observed traffic, false to use the
+ *                              levels requested by the async transfer library
+ * @return The status of the request. \ref MTB_HAL_UART_RSLT_ERR_BUSY if an async transfer is
+ *         in progress
+ */
+cy_rslt_t mtb_hal_uart_enable_adaptive_fifo(mtb_hal_uart_t* obj, bool enable);
+
+/** Release data held in the RX FIFO below the trigger level
+ *
+ * The SCB has no receive timeout, so this function must be called periodically (for example,
+ * from a timer every few character times) while adaptive FIFO levels are enabled. If the RX
+ * FIFO holds data below the trigger level and no new byte has arrived since the previous call,
+ * the trigger level is dropped so that the data is delivered to the pending read, the RX level
+ * is lowered for subsequent traffic, and the \ref MTB_HAL_UART_IRQ_RX_TIMEOUT event is raised.
+ *
+ * @param[in] obj               The UART object
+ * @return True if stranded data was released
+ */
+bool mtb_hal_uart_check_rx_timeout(mtb_hal_uart_t* obj);
+
+/** Get the adaptive FIFO trigger level statistics
+ *
+ * The counters are updated for all CPU based async transfers, whether or not adaptation is
+ * enabled, so the two modes can be compared.
+ *
+ * @param[in]  obj              The UART object
+ * @param[out] stats            Location to store the statistics
+ * @param[in]  reset            Whether to clear the counters after reading them
+ */
+void mtb_hal_uart_get_fifo_stats(mtb_hal_uart_t* obj, mtb_hal_uart_fifo_stats_t* stats,
+                                 bool reset);
+
 #endif /* defined(COMPONENT_MW_ASYNC_TRANSFER) */
 
 /**
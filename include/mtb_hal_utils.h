@@ -54,6 +54,10 @@ extern "C" {
 #define _MTB_HAL_MIN(actBufSize, bufSize)  (((uint32_t) (actBufSize) < (uint32_t) (bufSize)) ? \
                                            ((uint32_t) (actBufSize)) : ((uint32_t) (bufSize)) )
 
+/* Return the larger of two uint32_t values */
+#define _MTB_HAL_MAX(a, b)                 (((uint32_t) (a) > (uint32_t) (b)) ? \
+                                           ((uint32_t) (a)) : ((uint32_t) (b)) )
+
 #if defined(__cplusplus)
 }
 #endif
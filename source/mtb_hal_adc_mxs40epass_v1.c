@@ -26,9 +26,14 @@
 
 #include "mtb_hal_adc.h"
 #include <stdlib.h>
+#include <string.h>
 #include "cy_pdl.h"
 #include "mtb_hal_adc_mxs40epass_v1.h"
 #include "mtb_hal_system.h"
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER)
+#include "mtb_hal_dma.h"
+#include "mtb_hal_timer.h"
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER) */
 
 
 #if defined(__cplusplus)
@@ -41,6 +46,17 @@ extern "C" {
 *                           Defines
 *******************************************************************************/
 
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER)
+/* DMA events which end streaming */
+#define _MTB_HAL_ADC_STREAM_DMA_ERRORS \
+    (MTB_HAL_DMA_SRC_BUS_ERROR | MTB_HAL_DMA_DST_BUS_ERROR | MTB_HAL_DMA_SRC_MISAL | \
+     MTB_HAL_DMA_DST_MISAL | MTB_HAL_DMA_CURR_PTR_NULL | MTB_HAL_DMA_ACTIVE_CH_DISABLED | \
+     MTB_HAL_DMA_DESCR_BUS_ERROR | MTB_HAL_DMA_GENERIC_ERROR)
+#define _MTB_HAL_ADC_STREAM_DMA_EVENTS \
+    ((mtb_hal_dma_event_t)(MTB_HAL_DMA_TRANSFER_COMPLETE | MTB_HAL_DMA_DESCRIPTOR_COMPLETE | \
+                           _MTB_HAL_ADC_STREAM_DMA_ERRORS))
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER) */
+
 
 /*******************************************************************************
 *                           Typedefs
@@ -146,6 +162,181 @@ int32_t _mtb_hal_adc_read(const mtb_hal_adc_channel_t* obj)
 }
 
 
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER)
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_adc_stream_deliver
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_adc_stream_deliver(mtb_hal_adc_t* obj, uint32_t block, uint32_t timestamp)
+{
+    _mtb_hal_adc_stream_t* stream = &(obj->stream);
+    uint16_t* data = &(stream->buffer[block * stream->block_elements]);
+
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((void*)data,
+                                 (int32_t)(stream->block_elements * sizeof(uint16_t)));
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+
+    mtb_hal_adc_stream_callback_t callback =
+        (mtb_hal_adc_stream_callback_t)stream->callback_data.callback;
+    if (NULL != callback)
+    {
+        callback(stream->callback_data.callback_arg,
+                 (0U == block) ? MTB_HAL_ADC_STREAM_EVENT_HALF : MTB_HAL_ADC_STREAM_EVENT_FULL,
+                 data, timestamp);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_adc_stream_dma_event_callback
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_adc_stream_dma_event_callback(void* callback_arg, mtb_hal_dma_event_t event)
+{
+    mtb_hal_adc_t* obj = (mtb_hal_adc_t*)callback_arg;
+    _mtb_hal_adc_stream_t* stream = &(obj->stream);
+    if (NULL == stream->dma)
+    {
+        return;
+    }
+
+    uint32_t timestamp = (NULL != stream->timer) ? mtb_hal_timer_read(stream->timer) : 0U;
+
+    if (0U != ((uint32_t)event & _MTB_HAL_ADC_STREAM_DMA_ERRORS))
+    {
+        mtb_hal_adc_stream_callback_t callback =
+            (mtb_hal_adc_stream_callback_t)stream->callback_data.callback;
+        (void)mtb_hal_adc_stream_stop(obj);
+        if (NULL != callback)
+        {
+            callback(stream->callback_data.callback_arg, MTB_HAL_ADC_STREAM_EVENT_ERROR, NULL,
+                     timestamp);
+        }
+    }
+    else if (0U != ((uint32_t)event & MTB_HAL_DMA_DESCRIPTOR_COMPLETE))
+    {
+        /* End of the ring. The first block may not have been reported if the descriptor only
+         * interrupts at its end. */
+        if (!stream->half_reported)
+        {
+            _mtb_hal_adc_stream_deliver(obj, 0U, timestamp);
+        }
+        stream->half_reported = false;
+        _mtb_hal_adc_stream_deliver(obj, 1U, timestamp);
+    }
+    else if (!stream->half_reported &&
+             (mtb_hal_dma_get_transfer_index(stream->dma) >= stream->block_elements))
+    {
+        stream->half_reported = true;
+        _mtb_hal_adc_stream_deliver(obj, 0U, timestamp);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_adc_stream_get_channel_count
+//--------------------------------------------------------------------------------------------------
+uint32_t mtb_hal_adc_stream_get_channel_count(const mtb_hal_adc_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    return (uint32_t)_mtb_hal_adc_last_enabled(obj) - (uint32_t)_mtb_hal_adc_first_enabled(obj) +
+           1UL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_adc_stream_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_adc_stream_start(mtb_hal_adc_t* obj, mtb_hal_dma_t* dma,
+                                   const mtb_hal_adc_stream_config_t* config)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != dma);
+    CY_ASSERT(NULL != config);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != config->buffer) && (0U != config->scans_per_block)),
+                         MTB_HAL_ADC_RSLT_ERR_BAD_ARGUMENT);
+    CY_ASSERT_AND_RETURN((NULL == obj->stream.dma), MTB_HAL_ADC_RSLT_ERR_BUSY);
+    #else
+    if ((NULL == config->buffer) || (0U == config->scans_per_block))
+    {
+        return MTB_HAL_ADC_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if (NULL != obj->stream.dma)
+    {
+        return MTB_HAL_ADC_RSLT_ERR_BUSY;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+
+    _mtb_hal_adc_stream_t* stream = &(obj->stream);
+    uint8_t first_channel = _mtb_hal_adc_first_enabled(obj);
+
+    memset(stream, 0, sizeof(*stream));
+    stream->buffer = config->buffer;
+    stream->block_elements = mtb_hal_adc_stream_get_channel_count(obj) * config->scans_per_block;
+    stream->timer = config->timer;
+    stream->callback_data.callback = (cy_israddress)config->callback;
+    stream->callback_data.callback_arg = config->callback_arg;
+
+    cy_rslt_t result = mtb_hal_dma_disable(dma);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        /* Fails unless the X loop of the descriptor covers exactly one scan */
+        result = mtb_hal_dma_set_transfer(dma, (uint32_t)&(obj->base->CH[first_channel].RESULT),
+                                          (uint32_t)config->buffer, 2UL * stream->block_elements,
+                                          false);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = mtb_hal_dma_set_circular(dma, true);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_InvalidateDCache_by_Addr((void*)config->buffer,
+                                     (int32_t)(2UL * stream->block_elements * sizeof(uint16_t)));
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+
+        stream->dma = dma;
+        mtb_hal_dma_register_callback(dma, _mtb_hal_adc_stream_dma_event_callback, obj);
+        mtb_hal_dma_enable_event(dma, _MTB_HAL_ADC_STREAM_DMA_EVENTS, true);
+        result = mtb_hal_dma_enable(dma);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            mtb_hal_dma_enable_event(dma, _MTB_HAL_ADC_STREAM_DMA_EVENTS, false);
+            (void)mtb_hal_dma_set_circular(dma, false);
+            stream->dma = NULL;
+        }
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_adc_stream_stop
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_adc_stream_stop(mtb_hal_adc_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    mtb_hal_dma_t* dma = obj->stream.dma;
+
+    if (NULL != dma)
+    {
+        result = mtb_hal_dma_disable(dma);
+        mtb_hal_dma_enable_event(dma, _MTB_HAL_ADC_STREAM_DMA_EVENTS, false);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = mtb_hal_dma_set_circular(dma, false);
+        }
+        obj->stream.dma = NULL;
+    }
+    return result;
+}
+
+
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) && (MTB_HAL_DRIVER_AVAILABLE_TIMER) */
+
 #endif /* defined(CY_IP_MXS40EPASS_ESAR_INSTANCES) */
 
 #if defined(__cplusplus)
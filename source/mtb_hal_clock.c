@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include "mtb_hal_utils.h"
 #include "mtb_hal_clock.h"
+#include "mtb_hal_system.h"
 
 #if (MTB_HAL_DRIVER_AVAILABLE_CLOCK)
 
@@ -46,10 +47,257 @@ extern "C"
 *******************************************************************************/
 
 
+/*******************************************************************************
+*                           Private Variables
+*******************************************************************************/
+
+/* CLK_HF dividers that can be switched without touching the source path */
+static const struct
+{
+    cy_en_clkhf_dividers_t  setting;
+    uint32_t                value;
+} _mtb_hal_clock_hf_dividers[] =
+{
+    { CY_SYSCLK_CLKHF_NO_DIVIDE,   1U },
+    { CY_SYSCLK_CLKHF_DIVIDE_BY_2, 2U },
+    { CY_SYSCLK_CLKHF_DIVIDE_BY_4, 4U },
+    { CY_SYSCLK_CLKHF_DIVIDE_BY_8, 8U },
+};
+
+static mtb_hal_clock_hf_callback_data_t* _mtb_hal_clock_hf_callbacks = NULL;
+
+
 /*******************************************************************************
 *                       Private Function Definitions
 *******************************************************************************/
 
+/** Runs the CLK_HF change callbacks for one phase, up to but not including `stop`. Returns the
+    callback that refused the change in the CHECK_READY phase, or NULL. */
+static mtb_hal_clock_hf_callback_data_t* _mtb_hal_clock_hf_notify(
+    const mtb_hal_clock_hf_change_t* change, mtb_hal_clock_hf_phase_t phase,
+    const mtb_hal_clock_hf_callback_data_t* stop)
+{
+    for (mtb_hal_clock_hf_callback_data_t* cb = _mtb_hal_clock_hf_callbacks; cb != stop;
+         cb = cb->next)
+    {
+        if (!cb->callback(change, phase, cb->arg) && (MTB_HAL_CLOCK_HF_CHECK_READY == phase))
+        {
+            return cb;
+        }
+    }
+    return NULL;
+}
+
+
+/** Widens a frequency requirement into the range of acceptable frequencies */
+static void _mtb_hal_clock_shared_window(uint32_t frequency, uint32_t tolerance_ppm,
+                                         uint64_t* low, uint64_t* high)
+{
+    uint64_t delta = ((uint64_t)frequency * tolerance_ppm) / 1000000U;
+    *low  = (delta < frequency) ? (frequency - delta) : 0U;
+    *high = (uint64_t)frequency + delta;
+}
+
+
+/** Finds the divider whose output is closest to a request while staying within the
+    tolerance of every other peripheral on the shared divider, for a divider input of
+    `source_freq` */
+static cy_rslt_t _mtb_hal_clock_shared_plan(const mtb_hal_clock_shared_t* requester,
+                                            uint32_t source_freq, uint32_t frequency,
+                                            uint32_t tolerance_ppm, uint32_t* divider,
+                                            uint32_t* planned_freq)
+{
+    const mtb_hal_peri_div_t* div = requester->group->divider;
+    bool     shared = false;
+    uint64_t low;
+    uint64_t high;
+
+    _mtb_hal_clock_shared_window(frequency, tolerance_ppm, &low, &high);
+    for (const mtb_hal_clock_shared_t* consumer = requester->group->consumers; NULL != consumer;
+         consumer = consumer->next)
+    {
+        if ((consumer != requester) && (0U != consumer->frequency))
+        {
+            uint64_t consumer_low;
+            uint64_t consumer_high;
+            _mtb_hal_clock_shared_window(consumer->frequency, consumer->tolerance_ppm,
+                                         &consumer_low, &consumer_high);
+            low  = (consumer_low > low) ? consumer_low : low;
+            high = (consumer_high < high) ? consumer_high : high;
+            shared = true;
+        }
+    }
+
+    if (high > UINT32_MAX)
+    {
+        high = UINT32_MAX;
+    }
+    if ((0U == source_freq) || (low > high))
+    {
+        return shared ? MTB_HAL_CLOCK_RSLT_ERR_CONFLICT : MTB_HAL_CLOCK_RSLT_ERR_FREQ;
+    }
+
+    /* The closest output to the request is either the request's own divider or, when that falls
+       outside of the common window, a divider near one of its edges or its middle */
+    const uint32_t candidates[] =
+    {
+        frequency, (uint32_t)((low + high) / 2U), (uint32_t)low, (uint32_t)high
+    };
+    uint32_t best_err = UINT32_MAX;
+    for (uint32_t i = 0U; i < (sizeof(candidates) / sizeof(candidates[0])); ++i)
+    {
+        uint32_t candidate_div;
+        if (0U == candidates[i])
+        {
+            continue;
+        }
+        uint32_t out = _mtb_hal_clock_calc_peri_div(source_freq, div->div_type, candidates[i],
+                                                    &candidate_div);
+        uint32_t err = (out > frequency) ? (out - frequency) : (frequency - out);
+        if ((out >= low) && (out <= high) && (err < best_err))
+        {
+            best_err = err;
+            *divider = candidate_div;
+            *planned_freq = out;
+        }
+    }
+
+    if (UINT32_MAX == best_err)
+    {
+        return shared ? MTB_HAL_CLOCK_RSLT_ERR_CONFLICT : MTB_HAL_CLOCK_RSLT_ERR_FREQ;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+/** Plans and applies a request of a peripheral on a shared divider. Must be called from within a
+    critical section. On success the peripheral's requirement is updated. */
+static cy_rslt_t _mtb_hal_clock_shared_apply(mtb_hal_clock_shared_t* consumer, uint32_t frequency,
+                                             uint32_t tolerance_ppm)
+{
+    uint32_t divider;
+    uint32_t planned_freq;
+    uint32_t source_freq = mtb_hal_clock_get_peri_src_clock_freq(consumer->group->divider);
+    cy_rslt_t result = _mtb_hal_clock_shared_plan(consumer, source_freq, frequency, tolerance_ppm,
+                                                  &divider, &planned_freq);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        consumer->frequency = frequency;
+        consumer->tolerance_ppm = tolerance_ppm;
+        /* Leave the divider untouched if it already runs at the planned frequency so the other
+           peripherals do not see a glitch */
+        if (mtb_hal_clock_get_peri_clock_freq(consumer->group->divider) != planned_freq)
+        {
+            _mtb_hal_clock_set_peri_div(consumer->group->divider, divider);
+        }
+    }
+    return result;
+}
+
+
+/** Returns whether any peripheral on a shared divider still needs it running */
+static bool _mtb_hal_clock_shared_in_use(const mtb_hal_clock_shared_div_t* group)
+{
+    for (const mtb_hal_clock_shared_t* consumer = group->consumers; NULL != consumer;
+         consumer = consumer->next)
+    {
+        if (consumer->enabled)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/** Returns the peripheral divider behind a clock held with mtb_hal_clock_hold_peri_freq */
+static const mtb_hal_peri_div_t* _mtb_hal_clock_hold_get_div(const mtb_hal_clock_t* clock)
+{
+    return (&mtb_hal_clock_shared_interface == clock->interface)
+        ? ((const mtb_hal_clock_shared_t*)clock->clock_ref)->group->divider
+        : (const mtb_hal_peri_div_t*)clock->clock_ref;
+}
+
+
+/** Solves the divider of a held clock for a divider input of `source_freq`. Returns whether the
+    output stays within the hold's tolerance; on a shared divider it must also stay within the
+    tolerance of the other peripherals on it. */
+static bool _mtb_hal_clock_hold_solve(const mtb_hal_clock_peri_hold_t* hold, uint32_t source_freq,
+                                      uint32_t* divider)
+{
+    const mtb_hal_clock_t* clock = hold->clock;
+    if (&mtb_hal_clock_shared_interface == clock->interface)
+    {
+        uint32_t planned_freq;
+        return (CY_RSLT_SUCCESS ==
+                _mtb_hal_clock_shared_plan((const mtb_hal_clock_shared_t*)clock->clock_ref,
+                                           source_freq, hold->frequency, hold->tolerance_ppm,
+                                           divider, &planned_freq));
+    }
+
+    const mtb_hal_peri_div_t* div = (const mtb_hal_peri_div_t*)clock->clock_ref;
+    uint32_t out = _mtb_hal_clock_calc_peri_div(source_freq, div->div_type, hold->frequency,
+                                                divider);
+    return ((uint32_t)abs(_mtb_hal_utils_calculate_tolerance(MTB_HAL_TOLERANCE_PPM,
+                                                             hold->frequency, out)) <=
+            hold->tolerance_ppm);
+}
+
+
+/** CLK_HF change callback that recomputes a held peripheral divider */
+static bool _mtb_hal_clock_hold_callback(const mtb_hal_clock_hf_change_t* change,
+                                         mtb_hal_clock_hf_phase_t phase, void* callback_arg)
+{
+    mtb_hal_clock_peri_hold_t* hold = (mtb_hal_clock_peri_hold_t*)callback_arg;
+    const mtb_hal_peri_div_t*  div  = _mtb_hal_clock_hold_get_div(hold->clock);
+    bool accept = true;
+
+    switch (phase)
+    {
+        case MTB_HAL_CLOCK_HF_CHECK_READY:
+            hold->affected = (Cy_Sysclk_PeriPclkGetClkHfNum(div->clk_dst) == change->inst_num);
+            if (hold->affected)
+            {
+                /* The divider input scales with CLK_HF */
+                uint32_t source_freq =
+                    (uint32_t)(((uint64_t)mtb_hal_clock_get_peri_src_clock_freq(div) *
+                                change->new_hz) / change->old_hz);
+                accept = _mtb_hal_clock_hold_solve(hold, source_freq, &hold->divider);
+            }
+            break;
+
+        case MTB_HAL_CLOCK_HF_BEFORE_CHANGE:
+            /* Slow the peripheral down ahead of a faster CLK_HF */
+            if (hold->affected && (change->new_hz > change->old_hz))
+            {
+                _mtb_hal_clock_set_peri_div(div, hold->divider);
+            }
+            break;
+
+        case MTB_HAL_CLOCK_HF_AFTER_CHANGE:
+            if (hold->affected)
+            {
+                /* Solve again against the actual input in case the change did not happen as
+                   planned */
+                uint32_t divider = hold->divider;
+                (void)_mtb_hal_clock_hold_solve(hold, mtb_hal_clock_get_peri_src_clock_freq(div),
+                                                &divider);
+                if ((change->new_hz < change->old_hz) || (divider != hold->divider))
+                {
+                    _mtb_hal_clock_set_peri_div(div, divider);
+                }
+                hold->affected = false;
+            }
+            break;
+
+        default:
+            hold->affected = false;
+            break;
+    }
+    return accept;
+}
+
+
 
 /*******************************************************************************
 *                           Public Structures
@@ -69,6 +317,13 @@ const mtb_hal_clock_interface_t mtb_hal_clock_hf_interface =
     .set_enabled      = mtb_hal_clock_set_hf_clock_enabled,
 };
 
+const mtb_hal_clock_interface_t mtb_hal_clock_shared_interface =
+{
+    .get_frequency_hz = mtb_hal_clock_get_shared_clock_freq,
+    .set_frequency_hz = mtb_hal_clock_set_shared_clock_freq,
+    .set_enabled      = mtb_hal_clock_set_shared_clock_enabled,
+};
+
 /*******************************************************************************
 *                        Public Function Definitions
 *******************************************************************************/
@@ -100,82 +355,47 @@ cy_rslt_t mtb_hal_clock_set_peri_clock_freq(const void* clk, uint32_t frequency,
                                             uint32_t tolerance_ppm)
 {
     cy_en_divider_types_t dividerType;
-    uint32_t              dividerNum;
-    en_clk_dst_t          clk_dst;
     uint32_t              source_freq;
 
     CY_ASSERT(NULL != clk);
     CY_ASSERT(frequency != 0);
     dividerType = ((mtb_hal_peri_div_t*)clk)->div_type;
-    dividerNum  = ((mtb_hal_peri_div_t*)clk)->div_num;
-    clk_dst     = ((mtb_hal_peri_div_t*)clk)->clk_dst;
     /* Get CLK_HF frequency */
     source_freq = mtb_hal_clock_get_peri_src_clock_freq(clk);
     CY_ASSERT(source_freq != 0);
 
-    uint32_t dividerValue     = (source_freq / frequency);
-    uint32_t dividerFracValue = 0;
-    double   rslt_freq        = (((double)source_freq) / dividerValue); /* What frequency we'd
-                                                                           achieve with
-                                                                           this divider */
-
-    /* Calculate the fractional divider value */
-    if (dividerType >= CY_SYSCLK_DIV_16_5_BIT)
-    {
-        double closest_freq = rslt_freq;
-        double combined_div = 0;
-        // 31U = max fractional divider value
-        while ((closest_freq > (double)frequency) && dividerFracValue < 31U)
-        {
-            combined_div = ((double)dividerValue + ((double)(dividerFracValue + 1) / 32));
-            closest_freq = source_freq / combined_div;
-            if (closest_freq > (double)frequency)
-            {
-                dividerFracValue += 1;
-                rslt_freq = closest_freq;
-            }
-        }
-    }
+    uint32_t divider;
+    uint32_t rslt_freq = _mtb_hal_clock_calc_peri_div(source_freq, dividerType, frequency,
+                                                      &divider);
 
     if ((uint32_t)(abs(_mtb_hal_utils_calculate_tolerance(MTB_HAL_TOLERANCE_PPM, frequency,
-                                                          (uint32_t)rslt_freq))) > tolerance_ppm)
+                                                          rslt_freq))) > tolerance_ppm)
     {
         return MTB_HAL_CLOCK_RSLT_ERR_FREQ;
     }
 
-    dividerValue -= 1;
-    /* dividerFracValue does not need -1 here as this register is 0-inclusive */
-
-    #if defined (CY_IP_MXS28SRSS) || defined (CY_IP_MXS40SSRSS) || (defined (CY_IP_MXS40SRSS) && \
-    (CY_IP_MXS40SRSS_VERSION >= 2)) || defined (CY_IP_MXS22SRSS)
+    _mtb_hal_clock_set_peri_div(clk, divider);
+    return CY_RSLT_SUCCESS;
+}
 
-    Cy_SysClk_PeriPclkDisableDivider(clk_dst, dividerType, dividerNum);
-    if (dividerType < CY_SYSCLK_DIV_16_5_BIT)
-    {
-        Cy_SysClk_PeriPclkSetDivider(clk_dst, dividerType, dividerNum, dividerValue);
-    }
-    else
-    {
-        Cy_SysClk_PeriPclkSetFracDivider(clk_dst, dividerType, dividerNum, dividerValue,
-                                         dividerFracValue);
-    }
-    Cy_SysClk_PeriPclkEnableDivider(clk_dst, dividerType, dividerNum);
 
-    #elif (defined (CY_IP_MXS40SRSS) && (CY_IP_MXS40SRSS_VERSION < 2))
+/** Calculate the peripheral divider setting closest to a frequency */
+cy_rslt_t mtb_hal_clock_calc_peri_div(const void* clk, uint32_t frequency,
+                                      mtb_hal_clock_peri_div_result_t* result)
+{
+    CY_ASSERT(NULL != clk);
+    CY_ASSERT(NULL != result);
 
-    Cy_SysClk_PeriphDisableDivider(dividerType, dividerNum);
-    if (dividerType < CY_SYSCLK_DIV_16_5_BIT)
-    {
-        Cy_SysClk_PeriphSetDivider(dividerType, dividerNum, dividerValue);
-    }
-    else
+    uint32_t source_freq = mtb_hal_clock_get_peri_src_clock_freq(clk);
+    if ((0U == frequency) || (0U == source_freq))
     {
-        Cy_SysClk_PeriphSetFracDivider(dividerType, dividerNum, dividerValue, dividerFracValue);
+        return MTB_HAL_CLOCK_RSLT_ERR_FREQ;
     }
-    Cy_SysClk_PeriphEnableDivider(dividerType, dividerNum);
-
-    #endif // if defined (CY_IP_MXS28SRSS) || defined (CY_IP_MXS40SSRSS) || (defined
-    // (CY_IP_MXS40SRSS) && (CY_IP_MXS40SRSS_VERSION >= 2)) || defined (CY_IP_MXS22SRSS)
+    result->frequency = _mtb_hal_clock_calc_peri_div(source_freq,
+                                                     ((mtb_hal_peri_div_t*)clk)->div_type,
+                                                     frequency, &result->divider);
+    result->error_ppm = _mtb_hal_utils_calculate_tolerance(MTB_HAL_TOLERANCE_PPM, frequency,
+                                                           result->frequency);
     return CY_RSLT_SUCCESS;
 }
 
@@ -237,6 +457,92 @@ uint32_t mtb_hal_clock_get_peri_src_clock_freq(const void* clk)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_clock_calc_peri_div
+//--------------------------------------------------------------------------------------------------
+uint32_t _mtb_hal_clock_calc_peri_div(uint32_t source_freq, cy_en_divider_types_t div_type,
+                                      uint32_t frequency, uint32_t* divider)
+{
+    CY_ASSERT(0U != frequency);
+    CY_ASSERT(NULL != divider);
+
+    bool     fractional = (div_type >= CY_SYSCLK_DIV_16_5_BIT);
+    uint32_t step       = fractional ? 1U : (1UL << _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS);
+    uint32_t max_int    = (div_type == CY_SYSCLK_DIV_8_BIT) ? (1UL << 8U)
+                          : (div_type == CY_SYSCLK_DIV_24_5_BIT) ? (1UL << 24U) : (1UL << 16U);
+    uint64_t min_div    = 1ULL << _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS;
+    uint64_t max_div    = ((uint64_t)max_int << _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS) +
+                          (fractional ? (min_div - 1U) : 0U);
+    uint64_t scaled     = (uint64_t)source_freq << _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS;
+
+    /* The closest output comes from either the divider just below or just above the exact one */
+    uint64_t low  = ((scaled / frequency) / step) * step;
+    uint64_t high = low + step;
+    low  = (low < min_div) ? min_div : ((low > max_div) ? max_div : low);
+    high = (high < min_div) ? min_div : ((high > max_div) ? max_div : high);
+
+    uint32_t low_freq  = (uint32_t)((scaled + (low / 2U)) / low);
+    uint32_t high_freq = (uint32_t)((scaled + (high / 2U)) / high);
+    uint32_t low_err   = (low_freq > frequency) ? (low_freq - frequency) : (frequency - low_freq);
+    uint32_t high_err  = (high_freq > frequency) ? (high_freq - frequency)
+                         : (frequency - high_freq);
+
+    if (high_err < low_err)
+    {
+        *divider = (uint32_t)high;
+        return high_freq;
+    }
+    *divider = (uint32_t)low;
+    return low_freq;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_clock_set_peri_div
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_clock_set_peri_div(const void* clk, uint32_t divider)
+{
+    CY_ASSERT(NULL != clk);
+    cy_en_divider_types_t dividerType = ((mtb_hal_peri_div_t*)clk)->div_type;
+    uint32_t              dividerNum  = ((mtb_hal_peri_div_t*)clk)->div_num;
+    /* Both registers are 0-inclusive for the integer part only */
+    uint32_t dividerValue     = (divider >> _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS) - 1U;
+    uint32_t dividerFracValue = divider & ((1UL << _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS) - 1U);
+
+    #if defined (CY_IP_MXS28SRSS) || defined (CY_IP_MXS40SSRSS) || (defined (CY_IP_MXS40SRSS) && \
+    (CY_IP_MXS40SRSS_VERSION >= 2)) || defined (CY_IP_MXS22SRSS)
+    en_clk_dst_t clk_dst = ((mtb_hal_peri_div_t*)clk)->clk_dst;
+
+    Cy_SysClk_PeriPclkDisableDivider(clk_dst, dividerType, dividerNum);
+    if (dividerType < CY_SYSCLK_DIV_16_5_BIT)
+    {
+        Cy_SysClk_PeriPclkSetDivider(clk_dst, dividerType, dividerNum, dividerValue);
+    }
+    else
+    {
+        Cy_SysClk_PeriPclkSetFracDivider(clk_dst, dividerType, dividerNum, dividerValue,
+                                         dividerFracValue);
+    }
+    Cy_SysClk_PeriPclkEnableDivider(clk_dst, dividerType, dividerNum);
+
+    #elif (defined (CY_IP_MXS40SRSS) && (CY_IP_MXS40SRSS_VERSION < 2))
+
+    Cy_SysClk_PeriphDisableDivider(dividerType, dividerNum);
+    if (dividerType < CY_SYSCLK_DIV_16_5_BIT)
+    {
+        Cy_SysClk_PeriphSetDivider(dividerType, dividerNum, dividerValue);
+    }
+    else
+    {
+        Cy_SysClk_PeriphSetFracDivider(dividerType, dividerNum, dividerValue, dividerFracValue);
+    }
+    Cy_SysClk_PeriphEnableDivider(dividerType, dividerNum);
+
+    #endif // if defined (CY_IP_MXS28SRSS) || defined (CY_IP_MXS40SSRSS) || (defined
+    // (CY_IP_MXS40SRSS) && (CY_IP_MXS40SRSS_VERSION >= 2)) || defined (CY_IP_MXS22SRSS)
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_clock_get_hf_clock_freq
 //--------------------------------------------------------------------------------------------------
@@ -252,10 +558,183 @@ uint32_t mtb_hal_clock_get_hf_clock_freq(const void* clk)
 cy_rslt_t mtb_hal_clock_set_hf_clock_freq(const void* clk, uint32_t frequency,
                                           uint32_t tolerance_ppm)
 {
-    CY_UNUSED_PARAMETER(clk);
-    CY_UNUSED_PARAMETER(frequency);
-    CY_UNUSED_PARAMETER(tolerance_ppm);
-    return MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED;
+    CY_ASSERT(NULL != clk);
+    CY_ASSERT(frequency != 0);
+
+    uint32_t inst_num = ((mtb_hal_hf_clock_t*)clk)->inst_num;
+    cy_en_clkhf_dividers_t current = Cy_SysClk_ClkHfGetDivider(inst_num);
+    uint32_t old_hz      = Cy_SysClk_ClkHfGetFrequency(inst_num);
+    uint32_t source_freq = 0U;
+    uint32_t best        = 0U;
+    uint32_t best_err    = UINT32_MAX;
+
+    for (uint32_t i = 0U; i < (sizeof(_mtb_hal_clock_hf_dividers) /
+                               sizeof(_mtb_hal_clock_hf_dividers[0])); ++i)
+    {
+        if (_mtb_hal_clock_hf_dividers[i].setting == current)
+        {
+            source_freq = old_hz * _mtb_hal_clock_hf_dividers[i].value;
+        }
+    }
+    if (0U == source_freq)
+    {
+        /* CLK_HF runs from a divider this function does not switch between */
+        return MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED;
+    }
+
+    for (uint32_t i = 0U; i < (sizeof(_mtb_hal_clock_hf_dividers) /
+                               sizeof(_mtb_hal_clock_hf_dividers[0])); ++i)
+    {
+        uint32_t out = source_freq / _mtb_hal_clock_hf_dividers[i].value;
+        uint32_t err = (out > frequency) ? (out - frequency) : (frequency - out);
+        if (err < best_err)
+        {
+            best_err = err;
+            best = i;
+        }
+    }
+
+    mtb_hal_clock_hf_change_t change =
+    {
+        .inst_num = inst_num,
+        .old_hz   = old_hz,
+        .new_hz   = source_freq / _mtb_hal_clock_hf_dividers[best].value
+    };
+    if ((uint32_t)(abs(_mtb_hal_utils_calculate_tolerance(MTB_HAL_TOLERANCE_PPM, frequency,
+                                                          change.new_hz))) > tolerance_ppm)
+    {
+        return MTB_HAL_CLOCK_RSLT_ERR_FREQ;
+    }
+    if (_mtb_hal_clock_hf_dividers[best].setting == current)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    mtb_hal_clock_hf_callback_data_t* refused =
+        _mtb_hal_clock_hf_notify(&change, MTB_HAL_CLOCK_HF_CHECK_READY, NULL);
+    if (NULL != refused)
+    {
+        (void)_mtb_hal_clock_hf_notify(&change, MTB_HAL_CLOCK_HF_CHECK_FAIL, refused);
+        result = MTB_HAL_CLOCK_RSLT_ERR_CONFLICT;
+    }
+    else
+    {
+        (void)_mtb_hal_clock_hf_notify(&change, MTB_HAL_CLOCK_HF_BEFORE_CHANGE, NULL);
+
+        #if defined(CY_IP_M4CPUSS) || defined(CY_IP_M7CPUSS)
+        /* Flash wait states follow CLK_HF0: add them before it speeds up */
+        if ((0U == inst_num) && (change.new_hz > old_hz))
+        {
+            Cy_SysLib_SetWaitStates(false, CY_SYSLIB_DIV_ROUNDUP(change.new_hz, 1000000UL));
+        }
+        #endif
+        if (CY_SYSCLK_SUCCESS !=
+            Cy_SysClk_ClkHfSetDivider(inst_num, _mtb_hal_clock_hf_dividers[best].setting))
+        {
+            result = MTB_HAL_CLOCK_RSLT_ERR_FREQ;
+        }
+        SystemCoreClockUpdate();
+        change.new_hz = Cy_SysClk_ClkHfGetFrequency(inst_num);
+        #if defined(CY_IP_M4CPUSS) || defined(CY_IP_M7CPUSS)
+        /* ...and remove them only once it has slowed down */
+        if ((0U == inst_num) && (change.new_hz < old_hz))
+        {
+            Cy_SysLib_SetWaitStates(false, CY_SYSLIB_DIV_ROUNDUP(change.new_hz, 1000000UL));
+        }
+        #endif
+
+        (void)_mtb_hal_clock_hf_notify(&change, MTB_HAL_CLOCK_HF_AFTER_CHANGE, NULL);
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_register_hf_callback
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_clock_register_hf_callback(mtb_hal_clock_hf_callback_data_t* obj,
+                                        mtb_hal_clock_hf_callback_t callback, void* callback_arg)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != callback);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    mtb_hal_clock_hf_callback_data_t** link = &_mtb_hal_clock_hf_callbacks;
+    while (NULL != *link)
+    {
+        if (obj == *link)
+        {
+            /* Registering again moves the registration to the end instead of linking it twice */
+            *link = obj->next;
+        }
+        else
+        {
+            link = &(*link)->next;
+        }
+    }
+    obj->callback = callback;
+    obj->arg = callback_arg;
+    obj->next = NULL;
+    *link = obj;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_unregister_hf_callback
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_clock_unregister_hf_callback(mtb_hal_clock_hf_callback_data_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    mtb_hal_clock_hf_callback_data_t** link = &_mtb_hal_clock_hf_callbacks;
+    while ((NULL != *link) && (obj != *link))
+    {
+        link = &(*link)->next;
+    }
+    if (NULL != *link)
+    {
+        *link = obj->next;
+    }
+    obj->next = NULL;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_hold_peri_freq
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_clock_hold_peri_freq(mtb_hal_clock_peri_hold_t* hold,
+                                       const mtb_hal_clock_t* clock, uint32_t tolerance_ppm)
+{
+    CY_ASSERT(NULL != hold);
+    CY_ASSERT(NULL != clock);
+    if ((&mtb_hal_clock_peri_interface != clock->interface) &&
+        (&mtb_hal_clock_shared_interface != clock->interface))
+    {
+        return MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED;
+    }
+
+    hold->clock = clock;
+    hold->frequency = clock->interface->get_frequency_hz(clock->clock_ref);
+    hold->tolerance_ppm = tolerance_ppm;
+    hold->divider = 0U;
+    hold->affected = false;
+    mtb_hal_clock_register_hf_callback(&hold->cb_data, _mtb_hal_clock_hold_callback, hold);
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_release_peri_freq
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_clock_release_peri_freq(mtb_hal_clock_peri_hold_t* hold)
+{
+    CY_ASSERT(NULL != hold);
+    mtb_hal_clock_unregister_hf_callback(&hold->cb_data);
 }
 
 
@@ -275,16 +754,141 @@ cy_rslt_t mtb_hal_clock_set_hf_clock_enabled(const void* clk, bool enable)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_shared_attach
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_clock_shared_attach(mtb_hal_clock_shared_t* consumer,
+                                      mtb_hal_clock_shared_div_t* group, uint32_t frequency,
+                                      uint32_t tolerance_ppm)
+{
+    CY_ASSERT(NULL != consumer);
+    CY_ASSERT(NULL != group);
+    CY_ASSERT(NULL != group->divider);
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    consumer->group = group;
+    consumer->next = NULL;
+    consumer->frequency = 0U;
+    consumer->tolerance_ppm = 0U;
+    consumer->enabled = true;
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (0U != frequency)
+    {
+        result = _mtb_hal_clock_shared_apply(consumer, frequency, tolerance_ppm);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        consumer->next = group->consumers;
+        group->consumers = consumer;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        consumer->group = NULL;
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_shared_detach
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_clock_shared_detach(mtb_hal_clock_shared_t* consumer)
+{
+    CY_ASSERT(NULL != consumer);
+    mtb_hal_clock_shared_div_t* group = consumer->group;
+    if (NULL != group)
+    {
+        uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+        mtb_hal_clock_shared_t** link = &group->consumers;
+        while ((NULL != *link) && (consumer != *link))
+        {
+            link = &(*link)->next;
+        }
+        if (NULL != *link)
+        {
+            *link = consumer->next;
+        }
+        consumer->group = NULL;
+        consumer->next = NULL;
+        bool in_use = _mtb_hal_clock_shared_in_use(group);
+        mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+        if (!in_use)
+        {
+            (void)mtb_hal_clock_set_peri_clock_enabled(group->divider, false);
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_get_shared_clock_freq
+//--------------------------------------------------------------------------------------------------
+uint32_t mtb_hal_clock_get_shared_clock_freq(const void* clk)
+{
+    CY_ASSERT(NULL != clk);
+    CY_ASSERT(NULL != ((const mtb_hal_clock_shared_t*)clk)->group);
+    return mtb_hal_clock_get_peri_clock_freq(((const mtb_hal_clock_shared_t*)clk)->group->divider);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_set_shared_clock_freq
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_clock_set_shared_clock_freq(const void* clk, uint32_t frequency,
+                                              uint32_t tolerance_ppm)
+{
+    CY_ASSERT(NULL != clk);
+    CY_ASSERT(frequency != 0);
+    /* The interface passes the reference as const; the requirement it records is bookkeeping */
+    mtb_hal_clock_shared_t* consumer = (mtb_hal_clock_shared_t*)clk;
+    CY_ASSERT(NULL != consumer->group);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    cy_rslt_t result = _mtb_hal_clock_shared_apply(consumer, frequency, tolerance_ppm);
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_clock_set_shared_clock_enabled
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_clock_set_shared_clock_enabled(const void* clk, bool enable)
+{
+    CY_ASSERT(NULL != clk);
+    mtb_hal_clock_shared_t* consumer = (mtb_hal_clock_shared_t*)clk;
+    CY_ASSERT(NULL != consumer->group);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    consumer->enabled = enable;
+    bool in_use = _mtb_hal_clock_shared_in_use(consumer->group);
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    /* Only turn the divider off once the last peripheral that needs it lets go */
+    return (enable || !in_use)
+        ? mtb_hal_clock_set_peri_clock_enabled(consumer->group->divider, enable)
+        : CY_RSLT_SUCCESS;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_clock_set_enabled
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t mtb_hal_clock_set_enabled(mtb_hal_clock_t* clock, bool enabled, bool wait_for_lock)
 {
-    // API not implemented yet
-    CY_UNUSED_PARAMETER(clock);
-    CY_UNUSED_PARAMETER(enabled);
+    CY_ASSERT(NULL != clock);
+    CY_ASSERT(NULL != clock->interface);
+    /* Peripheral dividers and HF clock roots switch synchronously; there is no lock to wait for */
     CY_UNUSED_PARAMETER(wait_for_lock);
-    return MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED;
+    if (NULL == clock->interface->set_enabled)
+    {
+        return MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED;
+    }
+    return clock->interface->set_enabled(clock->clock_ref, enabled);
 }
 
 
@@ -294,11 +898,44 @@ cy_rslt_t mtb_hal_clock_set_enabled(mtb_hal_clock_t* clock, bool enabled, bool w
 cy_rslt_t mtb_hal_clock_set_frequency(mtb_hal_clock_t* clock, uint32_t hz,
                                       const mtb_hal_clock_tolerance_t* tolerance)
 {
-    // API not implemented yet
-    CY_UNUSED_PARAMETER(clock);
-    CY_UNUSED_PARAMETER(hz);
-    CY_UNUSED_PARAMETER(tolerance);
-    return MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED;
+    CY_ASSERT(NULL != clock);
+    CY_ASSERT(NULL != clock->interface);
+    if (NULL == clock->interface->set_frequency_hz)
+    {
+        return MTB_HAL_CLOCK_RSLT_ERR_NOT_SUPPORTED;
+    }
+    if (0U == hz)
+    {
+        return MTB_HAL_CLOCK_RSLT_ERR_FREQ;
+    }
+
+    /* The clock interfaces take the tolerance in PPM. Round down so the check is never looser
+       than requested. */
+    uint64_t tolerance_ppm = UINT32_MAX;
+    if (NULL != tolerance)
+    {
+        switch (tolerance->type)
+        {
+            case MTB_HAL_TOLERANCE_HZ:
+                tolerance_ppm = ((uint64_t)tolerance->value * 1000000U) / hz;
+                break;
+
+            case MTB_HAL_TOLERANCE_PPM:
+                tolerance_ppm = tolerance->value;
+                break;
+
+            case MTB_HAL_TOLERANCE_PERCENT:
+                tolerance_ppm = (uint64_t)tolerance->value * 10000U;
+                break;
+
+            default:
+                CY_ASSERT(false);
+                return MTB_HAL_CLOCK_RSLT_ERR_FREQ;
+        }
+    }
+    return clock->interface->set_frequency_hz(clock->clock_ref, hz,
+                                              (tolerance_ppm > UINT32_MAX)
+                                              ? UINT32_MAX : (uint32_t)tolerance_ppm);
 }
 
 
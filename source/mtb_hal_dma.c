@@ -84,23 +84,55 @@ cy_rslt_t mtb_hal_dma_setup(mtb_hal_dma_t* obj, const mtb_hal_dma_configurator_t
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_set_src_addr
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr, bool clean)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        return _mtb_hal_dma_dw_set_src_addr(obj, src_addr, clean);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        return _mtb_hal_dma_dmac_set_src_addr(obj, src_addr, clean);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+    return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_dma_set_src_addr
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t mtb_hal_dma_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
+{
+    return _mtb_hal_dma_set_src_addr(obj, src_addr, true);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_set_dst_addr
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr, bool clean)
 {
     CY_ASSERT(NULL != obj);
 
     #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
     if (MTB_HAL_DMA_DW == obj->dma_type)
     {
-        return _mtb_hal_dma_dw_set_src_addr(obj, src_addr);
+        return _mtb_hal_dma_dw_set_dst_addr(obj, dst_addr, clean);
     }
     #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
     #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
     if (MTB_HAL_DMA_DMAC == obj->dma_type)
     {
-        return _mtb_hal_dma_dmac_set_src_addr(obj, src_addr);
+        return _mtb_hal_dma_dmac_set_dst_addr(obj, dst_addr, clean);
     }
     #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
     return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
@@ -111,19 +143,28 @@ cy_rslt_t mtb_hal_dma_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
 // mtb_hal_dma_set_dst_addr
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t mtb_hal_dma_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
+{
+    return _mtb_hal_dma_set_dst_addr(obj, dst_addr, true);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_set_length
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_set_length(mtb_hal_dma_t* obj, uint32_t length, bool clean)
 {
     CY_ASSERT(NULL != obj);
 
     #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
     if (MTB_HAL_DMA_DW == obj->dma_type)
     {
-        return _mtb_hal_dma_dw_set_dst_addr(obj, dst_addr);
+        return _mtb_hal_dma_dw_set_length(obj, length, clean);
     }
     #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
     #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
     if (MTB_HAL_DMA_DMAC == obj->dma_type)
     {
-        return _mtb_hal_dma_dmac_set_dst_addr(obj, dst_addr);
+        return _mtb_hal_dma_dmac_set_length(obj, length, clean);
     }
     #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
     return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
@@ -134,19 +175,200 @@ cy_rslt_t mtb_hal_dma_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
 // mtb_hal_dma_set_length
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t mtb_hal_dma_set_length(mtb_hal_dma_t* obj, uint32_t length)
+{
+    return _mtb_hal_dma_set_length(obj, length, true);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_clean_descriptor
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_dma_clean_descriptor(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        _mtb_hal_dma_dw_clean_descriptor(obj);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        _mtb_hal_dma_dmac_clean_descriptor(obj);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_save_descriptor
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_dma_save_descriptor(mtb_hal_dma_t* obj, mtb_hal_dma_descriptor_t* saved)
+{
+    CY_ASSERT((NULL != obj) && (NULL != saved));
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        saved->dw = *(obj->descriptor.dw);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        saved->dmac = *(obj->descriptor.dmac);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_restore_descriptor
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_dma_restore_descriptor(mtb_hal_dma_t* obj, const mtb_hal_dma_descriptor_t* saved)
+{
+    CY_ASSERT((NULL != obj) && (NULL != saved));
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        *(obj->descriptor.dw) = saved->dw;
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        *(obj->descriptor.dmac) = saved->dmac;
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+    _mtb_hal_dma_clean_descriptor(obj);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_set_transfer
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_set_transfer(mtb_hal_dma_t* obj, uint32_t src_addr, uint32_t dst_addr,
+                                   uint32_t length, bool enable)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        return _mtb_hal_dma_dw_set_transfer(obj, src_addr, dst_addr, length, enable);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        return _mtb_hal_dma_dmac_set_transfer(obj, src_addr, dst_addr, length, enable);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+    return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_set_circular
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_set_circular(mtb_hal_dma_t* obj, bool enable)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        return _mtb_hal_dma_dw_set_circular(obj, enable);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        return _mtb_hal_dma_dmac_set_circular(obj, enable);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+    return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_get_transfer_index
+//--------------------------------------------------------------------------------------------------
+uint32_t mtb_hal_dma_get_transfer_index(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        return _mtb_hal_dma_dw_get_transfer_index(obj);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        return _mtb_hal_dma_dmac_get_transfer_index(obj);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+    return 0;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_set_scatter_gather
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_set_scatter_gather(mtb_hal_dma_t* obj, const mtb_hal_dma_sg_entry_t* entries,
+                                         size_t count, mtb_hal_dma_descriptor_t* pool,
+                                         size_t pool_size)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != entries) && (NULL != pool) && (0u != count) &&
+                          (count <= pool_size)), MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == entries) || (NULL == pool) || (0u == count) || (count > pool_size))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        return _mtb_hal_dma_dw_set_scatter_gather(obj, entries, count, pool);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        return _mtb_hal_dma_dmac_set_scatter_gather(obj, entries, count, pool);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+    return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_clear_scatter_gather
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_clear_scatter_gather(mtb_hal_dma_t* obj)
 {
     CY_ASSERT(NULL != obj);
 
     #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
     if (MTB_HAL_DMA_DW == obj->dma_type)
     {
-        return _mtb_hal_dma_dw_set_length(obj, length);
+        return _mtb_hal_dma_dw_clear_scatter_gather(obj);
     }
     #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
     #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
     if (MTB_HAL_DMA_DMAC == obj->dma_type)
     {
-        return _mtb_hal_dma_dmac_set_length(obj, length);
+        return _mtb_hal_dma_dmac_clear_scatter_gather(obj);
     }
     #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
     return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
@@ -128,7 +128,7 @@ cy_rslt_t _mtb_hal_dma_dmac_setup(mtb_hal_dma_t* obj, const mtb_hal_dma_configur
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dmac_set_src_addr
 //--------------------------------------------------------------------------------------------------
-cy_rslt_t _mtb_hal_dma_dmac_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
+cy_rslt_t _mtb_hal_dma_dmac_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr, bool clean)
 {
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dmac)),
@@ -142,7 +142,12 @@ cy_rslt_t _mtb_hal_dma_dmac_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
     _mtb_hal_dma_dmac_descriptor_set_src_addr(obj, src_addr);
 
     #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
-    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+    if (clean)
+    {
+        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+    }
+    #else
+    CY_UNUSED_PARAMETER(clean);
     #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
     return CY_RSLT_SUCCESS;
 }
@@ -151,7 +156,7 @@ cy_rslt_t _mtb_hal_dma_dmac_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dmac_set_dst_addr
 //--------------------------------------------------------------------------------------------------
-cy_rslt_t _mtb_hal_dma_dmac_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
+cy_rslt_t _mtb_hal_dma_dmac_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr, bool clean)
 {
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dmac)),
@@ -165,7 +170,12 @@ cy_rslt_t _mtb_hal_dma_dmac_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
     _mtb_hal_dma_dmac_descriptor_set_dst_addr(obj, dst_addr);
 
     #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
-    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+    if (clean)
+    {
+        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+    }
+    #else
+    CY_UNUSED_PARAMETER(clean);
     #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
     return CY_RSLT_SUCCESS;
 }
@@ -174,7 +184,55 @@ cy_rslt_t _mtb_hal_dma_dmac_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dmac_set_length
 //--------------------------------------------------------------------------------------------------
-cy_rslt_t _mtb_hal_dma_dmac_set_length(mtb_hal_dma_t* obj, uint32_t length)
+cy_rslt_t _mtb_hal_dma_dmac_set_length(mtb_hal_dma_t* obj, uint32_t length, bool clean)
+{
+    cy_rslt_t result;
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dmac)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dmac))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif // if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    result = _mtb_hal_dma_dmac_descriptor_set_length(obj, length);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        obj->expected_bursts = _mtb_hal_dma_dmac_get_expected_bursts(obj);
+    }
+
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    if (clean)
+    {
+        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+    }
+    #else
+    CY_UNUSED_PARAMETER(clean);
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_clean_descriptor
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_dma_dmac_clean_descriptor(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT((NULL != obj) && (NULL != obj->descriptor.dmac));
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+    #else
+    CY_UNUSED_PARAMETER(obj);
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_set_transfer
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dmac_set_transfer(mtb_hal_dma_t* obj, uint32_t src_addr, uint32_t dst_addr,
+                                         uint32_t length, bool enable)
 {
     cy_rslt_t result;
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
@@ -186,11 +244,41 @@ cy_rslt_t _mtb_hal_dma_dmac_set_length(mtb_hal_dma_t* obj, uint32_t length)
         return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
     }
     #endif // if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    /* The length is the only part that can be rejected; check it before touching the
+       descriptor */
     result = _mtb_hal_dma_dmac_descriptor_set_length(obj, length);
     if (CY_RSLT_SUCCESS == result)
     {
+        _mtb_hal_dma_dmac_descriptor_set_src_addr(obj, src_addr);
+        _mtb_hal_dma_dmac_descriptor_set_dst_addr(obj, dst_addr);
         obj->expected_bursts = _mtb_hal_dma_dmac_get_expected_bursts(obj);
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+        if (enable)
+        {
+            result = _mtb_hal_dma_dmac_enable(obj);
+        }
     }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_set_circular
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dmac_set_circular(mtb_hal_dma_t* obj, bool enable)
+{
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dmac)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dmac))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    _mtb_hal_dma_dmac_descriptor_set_circular(obj, enable);
 
     #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
     SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
@@ -199,6 +287,113 @@ cy_rslt_t _mtb_hal_dma_dmac_set_length(mtb_hal_dma_t* obj, uint32_t length)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_get_transfer_index
+//--------------------------------------------------------------------------------------------------
+uint32_t _mtb_hal_dma_dmac_get_transfer_index(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT((NULL != obj) || (NULL != obj->base.dmac_base));
+    return _mtb_hal_dma_dmac_channel_get_transfer_index(obj);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_set_scatter_gather
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dmac_set_scatter_gather(mtb_hal_dma_t* obj,
+                                               const mtb_hal_dma_sg_entry_t* entries,
+                                               size_t count, mtb_hal_dma_descriptor_t* pool)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) && (NULL != obj->descriptor.dmac)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dmac))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    if (_mtb_hal_dma_dmac_is_busy(obj))
+    {
+        return MTB_HAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
+    }
+
+    /* A descriptor paced by a single trigger moves the whole chain on that trigger */
+    bool chain_trigger = _mtb_hal_dma_dmac_is_descr_trigger(obj);
+    for (size_t i = 0; (i < count) && (CY_RSLT_SUCCESS == result); i++)
+    {
+        _mtb_hal_dmac_descriptor_t* descr = &pool[i].dmac;
+
+        *descr = *obj->descriptor.dmac;
+        Cy_DMAC_Descriptor_SetSrcAddress(descr, (void*)entries[i].src_addr);
+        Cy_DMAC_Descriptor_SetDstAddress(descr, (void*)entries[i].dst_addr);
+        result = _mtb_hal_dma_dmac_descr_set_length(descr, entries[i].length);
+        _mtb_hal_dma_dmac_descr_set_chain(descr,
+                                          ((i + 1u) == count) ? NULL : &pool[i + 1u].dmac,
+                                          chain_trigger);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        /* One cache maintenance operation for the whole chain */
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_CleanDCache_by_Addr((void*)pool, (int32_t)(count * sizeof(*pool)));
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+        _mtb_hal_dma_dmac_channel_set_descriptor(obj, &pool[0].dmac);
+        obj->chained = true;
+        obj->expected_bursts = _mtb_hal_dma_dmac_get_expected_bursts(obj);
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_clear_scatter_gather
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dmac_clear_scatter_gather(mtb_hal_dma_t* obj)
+{
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) && (NULL != obj->descriptor.dmac)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dmac))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    if (_mtb_hal_dma_dmac_is_busy(obj))
+    {
+        return MTB_HAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
+    }
+    _mtb_hal_dma_dmac_channel_set_descriptor(obj, obj->descriptor.dmac);
+    obj->chained = false;
+    obj->expected_bursts = _mtb_hal_dma_dmac_get_expected_bursts(obj);
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_set_mem_descriptor
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dmac_set_mem_descriptor(mtb_hal_dma_t* obj,
+                                               const _mtb_hal_dma_mem_descr_t* descr)
+{
+    if (_mtb_hal_dma_dmac_is_busy(obj))
+    {
+        return MTB_HAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
+    }
+    _mtb_hal_dma_dmac_descr_set_mem(obj->descriptor.dmac, descr);
+
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dmac, sizeof(*obj->descriptor.dmac));
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+    _mtb_hal_dma_dmac_channel_set_descriptor(obj, obj->descriptor.dmac);
+    obj->expected_bursts = _mtb_hal_dma_dmac_get_expected_bursts(obj);
+    return CY_RSLT_SUCCESS;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dmac_enable
 //--------------------------------------------------------------------------------------------------
@@ -239,6 +434,15 @@ cy_rslt_t _mtb_hal_dma_dmac_disable(mtb_hal_dma_t* obj)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dmac_set_priority
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_dma_dmac_set_priority(mtb_hal_dma_t* obj, uint8_t priority)
+{
+    _mtb_hal_dma_dmac_channel_set_priority(obj, (uint32_t)priority);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dmac_is_busy
 //--------------------------------------------------------------------------------------------------
@@ -57,10 +57,55 @@ static cy_rslt_t _mtb_hal_dma_dw_supported(const mtb_hal_dma_configurator_t* con
 }
 
 
+/** Set the transfer length of a descriptor */
+static cy_rslt_t _mtb_hal_dma_dw_descriptor_set_length(_mtb_hal_dw_descriptor_t* descriptor,
+                                                       uint32_t length)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_en_dma_descriptor_type_t descr_type = Cy_DMA_Descriptor_GetDescriptorType(descriptor);
+    if (CY_DMA_2D_TRANSFER == descr_type)
+    {
+        //This is based on the assumption that user/app does not want to change the burst size.
+        //Length in case of 2-D transfers need to be a mutiple of the burst size.TODO: check this
+        uint32_t xloop_count = Cy_DMA_Descriptor_GetXloopDataCount(descriptor);
+        if ((length > (xloop_count * CY_DMA_LOOP_COUNT_MAX)) || (length % xloop_count))
+        {
+            result = MTB_HAL_DMA_RSLT_ERR_INVALID_TRANSFER_SIZE;
+        }
+        else
+        {
+            Cy_DMA_Descriptor_SetYloopDataCount(descriptor, length/xloop_count);
+        }
+    }
+    else if (CY_DMA_1D_TRANSFER == descr_type)
+    {
+        if (length > CY_DMA_LOOP_COUNT_MAX)
+        {
+            result = MTB_HAL_DMA_RSLT_ERR_INVALID_TRANSFER_SIZE;
+        }
+        else
+        {
+            Cy_DMA_Descriptor_SetXloopDataCount(descriptor, length);
+        }
+    }
+    else
+    {
+        //Return not supported
+        result = MTB_HAL_DMA_RSLT_ERR_NOT_SUPPORTED;
+    }
+    return result;
+}
+
+
 /** Get the expected bursts based on the descriptor configuration */
 static uint32_t _mtb_hal_dma_dw_get_expected_bursts(mtb_hal_dma_t* obj)
 {
     uint32_t expected_bursts = 1;
+    /* A descriptor chain raises a single interrupt at the end of the chain */
+    if (obj->chained)
+    {
+        return expected_bursts;
+    }
     cy_en_dma_trigger_type_t intr_type = Cy_DMA_Descriptor_GetInterruptType(
         obj->descriptor.dw);
     if (CY_DMA_DESCR == intr_type)
@@ -75,6 +120,20 @@ static uint32_t _mtb_hal_dma_dw_get_expected_bursts(mtb_hal_dma_t* obj)
 }
 
 
+#if defined(MTB_HAL_PERF_ENABLE)
+/** Get the number of bytes moved by the current descriptor */
+static uint32_t _mtb_hal_dma_dw_get_descriptor_bytes(mtb_hal_dma_t* obj)
+{
+    uint32_t elements = Cy_DMA_Descriptor_GetXloopDataCount(obj->descriptor.dw);
+    if (CY_DMA_2D_TRANSFER == Cy_DMA_Descriptor_GetDescriptorType(obj->descriptor.dw))
+    {
+        elements *= Cy_DMA_Descriptor_GetYloopDataCount(obj->descriptor.dw);
+    }
+    return elements << (uint32_t)Cy_DMA_Descriptor_GetDataSize(obj->descriptor.dw);
+}
+
+
+#endif /* defined(MTB_HAL_PERF_ENABLE) */
 /** Convert PDL interrupt cause to hal dma event */
 __STATIC_INLINE mtb_hal_dma_event_t _mtb_hal_dma_dw_convert_interrupt_cause(mtb_hal_dma_t* obj,
                                                                             cy_en_dma_intr_cause_t cause)
@@ -121,6 +180,21 @@ static void _mtb_hal_dma_dw_irq_handler(mtb_hal_dma_t* obj)
     cy_en_dma_intr_cause_t cause = Cy_DMA_Channel_GetStatus(obj->base.dw_base, obj->channel);
     mtb_hal_dma_event_t event_type = _mtb_hal_dma_dw_convert_interrupt_cause(obj, cause);
     uint32_t events_to_callback = event_type & obj->irq_cause;
+    _MTB_HAL_PERF_ISR_ENTER(MTB_HAL_RSLT_MODULE_DMA, obj, cause);
+    #if defined(MTB_HAL_PERF_ENABLE)
+    if (0UL != ((uint32_t)event_type & (uint32_t)MTB_HAL_DMA_DESCRIPTOR_COMPLETE))
+    {
+        _mtb_hal_perf_complete(MTB_HAL_RSLT_MODULE_DMA, obj, &obj->perf, obj->perf_start,
+                               _mtb_hal_dma_dw_get_descriptor_bytes(obj));
+        /* A circular or re-triggered channel starts its next pass from here */
+        obj->perf_start = mtb_hal_perf_get_cycles();
+    }
+    else if ((CY_DMA_INTR_CAUSE_NO_INTR != cause) && (CY_DMA_INTR_CAUSE_COMPLETION != cause))
+    {
+        ++obj->perf.errors;
+        _MTB_HAL_PERF_TRACE(MTB_HAL_RSLT_MODULE_DMA, MTB_HAL_PERF_EVENT_ERROR, obj, cause);
+    }
+    #endif /* defined(MTB_HAL_PERF_ENABLE) */
 
     /* Clear all interrupts - this should be done prior to callback, in case the user wishes to
        chain DMA transfers
@@ -133,6 +207,7 @@ static void _mtb_hal_dma_dw_irq_handler(mtb_hal_dma_t* obj)
                                                                     (mtb_hal_dma_event_t)
                                                                     events_to_callback);
     }
+    _MTB_HAL_PERF_ISR_EXIT(MTB_HAL_RSLT_MODULE_DMA, obj);
 }
 
 
@@ -170,7 +245,7 @@ cy_rslt_t _mtb_hal_dma_dw_setup(mtb_hal_dma_t* obj, const mtb_hal_dma_configurat
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dw_set_src_addr
 //--------------------------------------------------------------------------------------------------
-cy_rslt_t _mtb_hal_dma_dw_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
+cy_rslt_t _mtb_hal_dma_dw_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr, bool clean)
 {
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dw)),
@@ -184,7 +259,12 @@ cy_rslt_t _mtb_hal_dma_dw_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
     Cy_DMA_Descriptor_SetSrcAddress(obj->descriptor.dw, (void*)src_addr);
 
     #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
-    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+    if (clean)
+    {
+        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+    }
+    #else
+    CY_UNUSED_PARAMETER(clean);
     #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
     return CY_RSLT_SUCCESS;
 }
@@ -193,7 +273,7 @@ cy_rslt_t _mtb_hal_dma_dw_set_src_addr(mtb_hal_dma_t* obj, uint32_t src_addr)
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dw_set_dst_addr
 //--------------------------------------------------------------------------------------------------
-cy_rslt_t _mtb_hal_dma_dw_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
+cy_rslt_t _mtb_hal_dma_dw_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr, bool clean)
 {
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dw)),
@@ -207,7 +287,12 @@ cy_rslt_t _mtb_hal_dma_dw_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
     Cy_DMA_Descriptor_SetDstAddress(obj->descriptor.dw, (void*)dst_addr);
 
     #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
-    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+    if (clean)
+    {
+        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+    }
+    #else
+    CY_UNUSED_PARAMETER(clean);
     #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
     return CY_RSLT_SUCCESS;
 }
@@ -217,10 +302,9 @@ cy_rslt_t _mtb_hal_dma_dw_set_dst_addr(mtb_hal_dma_t* obj, uint32_t dst_addr)
 // _mtb_hal_dma_dw_set_length
 //--------------------------------------------------------------------------------------------------
 /** Set the transfer length */
-cy_rslt_t _mtb_hal_dma_dw_set_length(mtb_hal_dma_t* obj, uint32_t length)
+cy_rslt_t _mtb_hal_dma_dw_set_length(mtb_hal_dma_t* obj, uint32_t length, bool clean)
 {
-    cy_en_dma_descriptor_type_t descr_type;
-    cy_rslt_t                   result = CY_RSLT_SUCCESS;
+    cy_rslt_t                   result;
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->base.dw_base)),
                          MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
@@ -230,48 +314,243 @@ cy_rslt_t _mtb_hal_dma_dw_set_length(mtb_hal_dma_t* obj, uint32_t length)
         return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
     }
     #endif // if defined(MTB_HAL_DISABLE_ERR_CHECK)
-    descr_type = Cy_DMA_Descriptor_GetDescriptorType(obj->descriptor.dw);
-    if (CY_DMA_2D_TRANSFER == descr_type)
+    result = _mtb_hal_dma_dw_descriptor_set_length(obj->descriptor.dw, length);
+    if (CY_RSLT_SUCCESS == result)
     {
-        //This is based on the assumption that user/app does not want to change the burst size.
-        //Length in case of 2-D transfers need to be a mutiple of the burst size.TODO: check this
-        uint32_t xloop_count = Cy_DMA_Descriptor_GetXloopDataCount(obj->descriptor.dw);
-        if ((length > (xloop_count * CY_DMA_LOOP_COUNT_MAX)) || (length % xloop_count))
+        obj->expected_bursts = _mtb_hal_dma_dw_get_expected_bursts(obj);
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        if (clean)
         {
-            result = MTB_HAL_DMA_RSLT_ERR_INVALID_TRANSFER_SIZE;
+            SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
         }
-        else
+        #else
+        CY_UNUSED_PARAMETER(clean);
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_clean_descriptor
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_dma_dw_clean_descriptor(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT((NULL != obj) && (NULL != obj->descriptor.dw));
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+    #else
+    CY_UNUSED_PARAMETER(obj);
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_set_transfer
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dw_set_transfer(mtb_hal_dma_t* obj, uint32_t src_addr, uint32_t dst_addr,
+                                       uint32_t length, bool enable)
+{
+    cy_rslt_t                   result;
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dw)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dw))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif // if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    /* The length is the only part that can be rejected; check it before touching the
+       descriptor */
+    result = _mtb_hal_dma_dw_descriptor_set_length(obj->descriptor.dw, length);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        Cy_DMA_Descriptor_SetSrcAddress(obj->descriptor.dw, (void*)src_addr);
+        Cy_DMA_Descriptor_SetDstAddress(obj->descriptor.dw, (void*)dst_addr);
+        obj->expected_bursts = _mtb_hal_dma_dw_get_expected_bursts(obj);
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+        if (enable)
         {
-            Cy_DMA_Descriptor_SetYloopDataCount(obj->descriptor.dw, length/xloop_count);
+            result = _mtb_hal_dma_dw_enable(obj);
         }
     }
-    else if (CY_DMA_1D_TRANSFER == descr_type)
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_set_circular
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dw_set_circular(mtb_hal_dma_t* obj, bool enable)
+{
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) || (NULL != obj->descriptor.dw)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dw))
     {
-        if (length > CY_DMA_LOOP_COUNT_MAX)
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    /* Chain the descriptor to itself and keep the channel enabled so that the next trigger
+       restarts the transfer from the beginning of the descriptor */
+    Cy_DMA_Descriptor_SetNextDescriptor(obj->descriptor.dw, enable ? obj->descriptor.dw : NULL);
+    Cy_DMA_Descriptor_SetChannelState(obj->descriptor.dw,
+                                      enable ? CY_DMA_CHANNEL_ENABLED : CY_DMA_CHANNEL_DISABLED);
+
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_get_transfer_index
+//--------------------------------------------------------------------------------------------------
+uint32_t _mtb_hal_dma_dw_get_transfer_index(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT((NULL != obj) || (NULL != obj->base.dw_base));
+
+    uint32_t index = Cy_DMA_Channel_GetCurrentXloopIndex(obj->base.dw_base, obj->channel);
+    if (CY_DMA_2D_TRANSFER == Cy_DMA_Descriptor_GetDescriptorType(obj->descriptor.dw))
+    {
+        index += Cy_DMA_Channel_GetCurrentYloopIndex(obj->base.dw_base, obj->channel) *
+                 Cy_DMA_Descriptor_GetXloopDataCount(obj->descriptor.dw);
+    }
+    return index;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_set_scatter_gather
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dw_set_scatter_gather(mtb_hal_dma_t* obj,
+                                             const mtb_hal_dma_sg_entry_t* entries,
+                                             size_t count, mtb_hal_dma_descriptor_t* pool)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) && (NULL != obj->descriptor.dw)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dw))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    if (_mtb_hal_dma_dw_is_busy(obj))
+    {
+        return MTB_HAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
+    }
+
+    /* A descriptor paced by a single trigger moves the whole chain on that trigger */
+    bool chain_trigger =
+        (CY_DMA_DESCR == Cy_DMA_Descriptor_GetTriggerInType(obj->descriptor.dw));
+    for (size_t i = 0; (i < count) && (CY_RSLT_SUCCESS == result); i++)
+    {
+        _mtb_hal_dw_descriptor_t* descr = &pool[i].dw;
+        bool last = ((i + 1u) == count);
+
+        *descr = *obj->descriptor.dw;
+        Cy_DMA_Descriptor_SetSrcAddress(descr, (void*)entries[i].src_addr);
+        Cy_DMA_Descriptor_SetDstAddress(descr, (void*)entries[i].dst_addr);
+        result = _mtb_hal_dma_dw_descriptor_set_length(descr, entries[i].length);
+        Cy_DMA_Descriptor_SetInterruptType(descr, CY_DMA_DESCR_CHAIN);
+        if (chain_trigger)
         {
-            result = MTB_HAL_DMA_RSLT_ERR_INVALID_TRANSFER_SIZE;
+            Cy_DMA_Descriptor_SetTriggerInType(descr, CY_DMA_DESCR_CHAIN);
         }
-        else
+        Cy_DMA_Descriptor_SetNextDescriptor(descr, last ? NULL : &pool[i + 1u].dw);
+        if (!last)
         {
-            Cy_DMA_Descriptor_SetXloopDataCount(obj->descriptor.dw, length);
+            Cy_DMA_Descriptor_SetChannelState(descr, CY_DMA_CHANNEL_ENABLED);
         }
     }
-    else
-    {
-        //Return not supported
-        result = MTB_HAL_DMA_RSLT_ERR_NOT_SUPPORTED;
-    }
+
     if (CY_RSLT_SUCCESS == result)
     {
-        obj->expected_bursts = _mtb_hal_dma_dw_get_expected_bursts(obj);
+        /* One cache maintenance operation for the whole chain */
         #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
-        SCB_CleanDCache_by_Addr((void*)obj->descriptor.dw, sizeof(*obj->descriptor.dw));
+        SCB_CleanDCache_by_Addr((void*)pool, (int32_t)(count * sizeof(*pool)));
         #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+        Cy_DMA_Channel_SetDescriptor(obj->base.dw_base, obj->channel, &pool[0].dw);
+        obj->chained = true;
+        obj->expected_bursts = _mtb_hal_dma_dw_get_expected_bursts(obj);
     }
     return result;
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_clear_scatter_gather
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dw_clear_scatter_gather(mtb_hal_dma_t* obj)
+{
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != obj) && (NULL != obj->descriptor.dw)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == obj) || (NULL == obj->descriptor.dw))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    if (_mtb_hal_dma_dw_is_busy(obj))
+    {
+        return MTB_HAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
+    }
+    Cy_DMA_Channel_SetDescriptor(obj->base.dw_base, obj->channel, obj->descriptor.dw);
+    obj->chained = false;
+    obj->expected_bursts = _mtb_hal_dma_dw_get_expected_bursts(obj);
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_set_mem_descriptor
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_dma_dw_set_mem_descriptor(mtb_hal_dma_t* obj,
+                                             const _mtb_hal_dma_mem_descr_t* descr)
+{
+    _mtb_hal_dw_descriptor_t* dw = obj->descriptor.dw;
+    if (_mtb_hal_dma_dw_is_busy(obj))
+    {
+        return MTB_HAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
+    }
+
+    /* The whole descriptor runs on one software trigger and stops the channel when done */
+    Cy_DMA_Descriptor_SetDescriptorType(dw, CY_DMA_2D_TRANSFER);
+    Cy_DMA_Descriptor_SetSrcAddress(dw, (void*)descr->src);
+    Cy_DMA_Descriptor_SetDstAddress(dw, (void*)descr->dst);
+    Cy_DMA_Descriptor_SetDataSize(dw, (cy_en_dma_data_size_t)descr->data_size);
+    Cy_DMA_Descriptor_SetSrcTransferSize(dw, CY_DMA_TRANSFER_SIZE_DATA);
+    Cy_DMA_Descriptor_SetDstTransferSize(dw, CY_DMA_TRANSFER_SIZE_DATA);
+    Cy_DMA_Descriptor_SetXloopDataCount(dw, descr->x_count);
+    Cy_DMA_Descriptor_SetXloopSrcIncrement(dw, descr->x_src_inc);
+    Cy_DMA_Descriptor_SetXloopDstIncrement(dw, descr->x_dst_inc);
+    Cy_DMA_Descriptor_SetYloopDataCount(dw, descr->y_count);
+    Cy_DMA_Descriptor_SetYloopSrcIncrement(dw, descr->y_src_inc);
+    Cy_DMA_Descriptor_SetYloopDstIncrement(dw, descr->y_dst_inc);
+    Cy_DMA_Descriptor_SetTriggerInType(dw, CY_DMA_DESCR);
+    Cy_DMA_Descriptor_SetTriggerOutType(dw, CY_DMA_DESCR);
+    Cy_DMA_Descriptor_SetInterruptType(dw, CY_DMA_DESCR);
+    Cy_DMA_Descriptor_SetRetrigger(dw, CY_DMA_RETRIG_IM);
+    Cy_DMA_Descriptor_SetNextDescriptor(dw, NULL);
+    Cy_DMA_Descriptor_SetChannelState(dw, CY_DMA_CHANNEL_DISABLED);
+
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void*)dw, sizeof(*dw));
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+    Cy_DMA_Channel_SetDescriptor(obj->base.dw_base, obj->channel, dw);
+    obj->expected_bursts = _mtb_hal_dma_dw_get_expected_bursts(obj);
+    return CY_RSLT_SUCCESS;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dw_enable
 //--------------------------------------------------------------------------------------------------
@@ -287,6 +566,10 @@ cy_rslt_t _mtb_hal_dma_dw_enable(mtb_hal_dma_t* obj)
     }
     #endif
     /* Enable the DMA channel */
+    #if defined(MTB_HAL_PERF_ENABLE)
+    obj->perf_start = mtb_hal_perf_get_cycles();
+    ++obj->perf.transfers;
+    #endif /* defined(MTB_HAL_PERF_ENABLE) */
     Cy_DMA_Channel_Enable(obj->base.dw_base, obj->channel);
     return CY_RSLT_SUCCESS;
 }
@@ -324,6 +607,15 @@ bool _mtb_hal_dma_dw_is_busy(mtb_hal_dma_t* obj)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_dw_set_priority
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_dma_dw_set_priority(mtb_hal_dma_t* obj, uint8_t priority)
+{
+    Cy_DMA_Channel_SetPriority(obj->base.dw_base, obj->channel, (uint32_t)priority);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_dma_dw_start_transfer
 //--------------------------------------------------------------------------------------------------
@@ -346,6 +638,9 @@ cy_rslt_t _mtb_hal_dma_dw_start_transfer(mtb_hal_dma_t* obj)
     }
 
     /* Set SW trigger for the channel */
+    #if defined(MTB_HAL_PERF_ENABLE)
+    obj->perf_start = mtb_hal_perf_get_cycles();
+    #endif /* defined(MTB_HAL_PERF_ENABLE) */
     Cy_DMA_Channel_SetSWTrigger(obj->base.dw_base, obj->channel);
     return CY_RSLT_SUCCESS;
 }
@@ -0,0 +1,559 @@
+/***************************************************************************//**
+* \file mtb_hal_dma_mem.c
+*
+* \brief
+* Implements memory copy and fill on top of the DMA channel pool, with a
+* fallback to the CPU for transfers too short to benefit.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024-2025 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+#include "mtb_hal_dma.h"
+#include "mtb_hal_system.h"
+#include "mtb_hal_utils.h"
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+
+#if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+#include "mtb_hal_dma_dmac.h"
+#endif
+#if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+#include "mtb_hal_dma_dw.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/* Largest loop increment both DMA types accept, in elements. Also bounds the row length of a
+   linear transfer, whose rows are laid end to end. */
+#define _MTB_HAL_DMA_MEM_INC_MAX                (2047u)
+/* Smallest block timed by the calibration */
+#define _MTB_HAL_DMA_MEM_CALIBRATE_MIN          (32u)
+
+/* Events that end a memory transfer */
+#define _MTB_HAL_DMA_MEM_EVENTS \
+    ((mtb_hal_dma_event_t)(MTB_HAL_DMA_DESCRIPTOR_COMPLETE | MTB_HAL_DMA_SRC_BUS_ERROR | \
+                           MTB_HAL_DMA_DST_BUS_ERROR | MTB_HAL_DMA_SRC_MISAL | \
+                           MTB_HAL_DMA_DST_MISAL | MTB_HAL_DMA_CURR_PTR_NULL | \
+                           MTB_HAL_DMA_ACTIVE_CH_DISABLED | MTB_HAL_DMA_DESCR_BUS_ERROR))
+
+static uint32_t _mtb_hal_dma_mem_threshold = MTB_HAL_DMA_MEM_THRESHOLD_DEFAULT;
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_acquire
+//--------------------------------------------------------------------------------------------------
+/* Takes a channel from the channel pool. The DMAC suits memory to memory transfers best, and
+ * running at the lowest priority keeps them from delaying peripheral transfers. The descriptor
+ * the pool user configured is saved, memory transfers rewrite it. A channel with a
+ * scatter-gather chain attached is given back untouched. */
+static mtb_hal_dma_t* _mtb_hal_dma_mem_acquire(mtb_hal_dma_mem_xfer_t* xfer)
+{
+    mtb_hal_dma_t* channel = NULL;
+    if (CY_RSLT_SUCCESS != mtb_hal_dma_pool_alloc(&channel, MTB_HAL_DMA_PRIORITY_LOWEST,
+                                                  MTB_HAL_DMA_DMAC, true))
+    {
+        return NULL;
+    }
+    if (channel->chained)
+    {
+        (void)mtb_hal_dma_pool_free(channel);
+        return NULL;
+    }
+
+    _mtb_hal_dma_save_descriptor(channel, &(xfer->saved_descr));
+    channel->mem_xfer = xfer;
+    return channel;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_release
+//--------------------------------------------------------------------------------------------------
+/* Puts the saved descriptor back while the channel is still idle and owned, then returns it to
+ * the pool, which clears the callback and events as for every free channel */
+static void _mtb_hal_dma_mem_release(mtb_hal_dma_t* channel)
+{
+    const mtb_hal_dma_mem_xfer_t* xfer = channel->mem_xfer;
+    _mtb_hal_dma_restore_descriptor(channel, &(xfer->saved_descr));
+    /* Point the channel at the restored descriptor again */
+    (void)mtb_hal_dma_clear_scatter_gather(channel);
+    channel->mem_xfer = NULL;
+    (void)mtb_hal_dma_pool_free(channel);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_set_descriptor
+//--------------------------------------------------------------------------------------------------
+static cy_rslt_t _mtb_hal_dma_mem_set_descriptor(mtb_hal_dma_t* channel,
+                                                 const _mtb_hal_dma_mem_descr_t* descr)
+{
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == channel->dma_type)
+    {
+        return _mtb_hal_dma_dw_set_mem_descriptor(channel, descr);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == channel->dma_type)
+    {
+        return _mtb_hal_dma_dmac_set_mem_descriptor(channel, descr);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+    return MTB_HAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_next
+//--------------------------------------------------------------------------------------------------
+/* Runs as many rows as one descriptor allows, then the partial last row once the full rows are
+ * done. */
+static cy_rslt_t _mtb_hal_dma_mem_next(mtb_hal_dma_t* channel, mtb_hal_dma_mem_xfer_t* xfer)
+{
+    _mtb_hal_dma_mem_descr_t* descr = &(xfer->descr);
+    if (0u == xfer->rows)
+    {
+        descr->x_count = xfer->tail;
+        xfer->rows = 1u;
+        xfer->tail = 0u;
+    }
+    descr->y_count = _MTB_HAL_MIN(xfer->rows, mtb_hal_dma_get_max_elements_per_burst(channel));
+    xfer->rows -= descr->y_count;
+
+    cy_rslt_t result = _mtb_hal_dma_mem_set_descriptor(channel, descr);
+    /* Move past the rows just handed to the channel */
+    descr->src += (uint32_t)((int32_t)descr->y_count * descr->y_src_inc) << descr->data_size;
+    descr->dst += (uint32_t)((int32_t)descr->y_count * descr->y_dst_inc) << descr->data_size;
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = mtb_hal_dma_enable(channel);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = mtb_hal_dma_start_transfer(channel);
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_complete
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_dma_mem_complete(mtb_hal_dma_mem_xfer_t* xfer, cy_rslt_t status)
+{
+    mtb_hal_dma_t* channel = xfer->channel;
+    if (NULL != channel)
+    {
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_InvalidateDCache_by_Addr((void*)xfer->dst_addr, (int32_t)xfer->dst_span);
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+        xfer->channel = NULL;
+        _mtb_hal_dma_mem_release(channel);
+    }
+    xfer->status = status;
+    if (NULL != xfer->callback_data.callback)
+    {
+        ((mtb_hal_dma_mem_callback_t)xfer->callback_data.callback)(
+            xfer->callback_data.callback_arg, status);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_event
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_dma_mem_event(void* callback_arg, mtb_hal_dma_event_t event)
+{
+    mtb_hal_dma_t* channel = (mtb_hal_dma_t*)callback_arg;
+    mtb_hal_dma_mem_xfer_t* xfer = channel->mem_xfer;
+    if (NULL == xfer)
+    {
+        return;
+    }
+
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    if (0u != ((uint32_t)event & ~(uint32_t)MTB_HAL_DMA_DESCRIPTOR_COMPLETE))
+    {
+        status = MTB_HAL_DMA_RSLT_ERR_TRANSFER;
+    }
+    else if ((0u != xfer->rows) || (0u != xfer->tail))
+    {
+        status = _mtb_hal_dma_mem_next(channel, xfer);
+        if (CY_RSLT_SUCCESS == status)
+        {
+            return;
+        }
+    }
+    _mtb_hal_dma_mem_complete(xfer, status);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_run_cpu
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_dma_mem_run_cpu(mtb_hal_dma_mem_xfer_t* xfer)
+{
+    const _mtb_hal_dma_mem_descr_t* descr = &(xfer->descr);
+    uint32_t src = descr->src;
+    uint32_t dst = descr->dst;
+    size_t row = (size_t)descr->x_count << descr->data_size;
+
+    for (uint32_t i = 0u; i < xfer->rows; i++)
+    {
+        if (0 == descr->x_src_inc)
+        {
+            (void)memset((void*)dst, (int)(xfer->pattern & 0xFFu), row);
+        }
+        else
+        {
+            (void)memcpy((void*)dst, (const void*)src, row);
+        }
+        src += (uint32_t)descr->y_src_inc << descr->data_size;
+        dst += (uint32_t)descr->y_dst_inc << descr->data_size;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_submit
+//--------------------------------------------------------------------------------------------------
+/* Starts a transfer whose descriptor holds the full rows. A single row longer than a loop is cut
+ * into rows laid end to end. Transfers shorter than `threshold` run on the CPU, as do those no
+ * channel is free for unless `dma_only` is set, in which case they fail instead. */
+static cy_rslt_t _mtb_hal_dma_mem_submit(mtb_hal_dma_mem_xfer_t* xfer, uint32_t length,
+                                         uint32_t threshold, bool dma_only,
+                                         mtb_hal_dma_mem_callback_t callback, void* callback_arg)
+{
+    _mtb_hal_dma_mem_descr_t* descr = &(xfer->descr);
+    mtb_hal_dma_t* channel = NULL;
+
+    xfer->channel = NULL;
+    xfer->tail = 0u;
+    xfer->callback_data.callback = (cy_israddress)callback;
+    xfer->callback_data.callback_arg = callback_arg;
+
+    if (length >= threshold)
+    {
+        channel = _mtb_hal_dma_mem_acquire(xfer);
+    }
+    if (NULL != channel)
+    {
+        uint32_t limit = _MTB_HAL_MIN(mtb_hal_dma_get_max_elements_per_burst(channel),
+                                      _MTB_HAL_DMA_MEM_INC_MAX);
+        if ((1u == xfer->rows) && (descr->x_count > limit))
+        {
+            xfer->rows = descr->x_count / limit;
+            xfer->tail = descr->x_count % limit;
+            descr->x_count = limit;
+            descr->y_src_inc = (descr->x_src_inc != 0) ? (int32_t)limit : 0;
+            descr->y_dst_inc = (int32_t)limit;
+        }
+        else if ((descr->x_count > limit) || (descr->y_src_inc > (int32_t)limit) ||
+                 (descr->y_dst_inc > (int32_t)limit))
+        {
+            /* Not expressible as one DMA loop; leave it to the CPU */
+            _mtb_hal_dma_mem_release(channel);
+            channel = NULL;
+        }
+    }
+
+    if ((NULL == channel) && dma_only)
+    {
+        xfer->status = MTB_HAL_DMA_RSLT_WARN_NO_CHANNEL;
+        return MTB_HAL_DMA_RSLT_WARN_NO_CHANNEL;
+    }
+    if (NULL == channel)
+    {
+        _mtb_hal_dma_mem_run_cpu(xfer);
+        _mtb_hal_dma_mem_complete(xfer, CY_RSLT_SUCCESS);
+        return CY_RSLT_SUCCESS;
+    }
+
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    if (0u != xfer->src_span)
+    {
+        SCB_CleanDCache_by_Addr((void*)xfer->src_addr, (int32_t)xfer->src_span);
+    }
+    else
+    {
+        SCB_CleanDCache_by_Addr((void*)&(xfer->pattern), (int32_t)sizeof(xfer->pattern));
+    }
+    /* Write back partial lines at the edges so they cannot be evicted over the new data later */
+    SCB_CleanInvalidateDCache_by_Addr((void*)xfer->dst_addr, (int32_t)xfer->dst_span);
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+
+    xfer->channel = channel;
+    xfer->status = MTB_HAL_DMA_RSLT_WARN_IN_PROGRESS;
+    mtb_hal_dma_register_callback(channel, _mtb_hal_dma_mem_event, channel);
+    mtb_hal_dma_enable_event(channel, (mtb_hal_dma_event_t)~0u, false);
+    mtb_hal_dma_enable_event(channel, _MTB_HAL_DMA_MEM_EVENTS, true);
+
+    cy_rslt_t result = _mtb_hal_dma_mem_next(channel, xfer);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        xfer->callback_data.callback = NULL;
+        _mtb_hal_dma_mem_complete(xfer, result);
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_mem_set_copy
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_dma_mem_set_copy(mtb_hal_dma_mem_xfer_t* xfer, void* dst, const void* src,
+                                      size_t length)
+{
+    /* Move words when everything is word aligned */
+    uint8_t data_size = (0u == (((uint32_t)dst | (uint32_t)src | (uint32_t)length) & 3u)) ? 2u : 0u;
+    _mtb_hal_dma_mem_descr_t* descr = &(xfer->descr);
+    descr->src = (uint32_t)src;
+    descr->dst = (uint32_t)dst;
+    descr->data_size = data_size;
+    descr->x_count = (uint32_t)length >> data_size;
+    descr->x_src_inc = 1;
+    descr->x_dst_inc = 1;
+    descr->y_src_inc = 0;
+    descr->y_dst_inc = 0;
+    xfer->rows = 1u;
+    xfer->src_addr = (uint32_t)src;
+    xfer->src_span = (uint32_t)length;
+    xfer->dst_addr = (uint32_t)dst;
+    xfer->dst_span = (uint32_t)length;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_mem_calibrate
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_mem_calibrate(uint8_t* scratch, size_t size)
+{
+    #if (CY_CPU_CORTEX_M0P)
+    /* The measurement is timed with the DWT cycle counter, which this core does not have */
+    CY_UNUSED_PARAMETER(scratch);
+    CY_UNUSED_PARAMETER(size);
+    return MTB_HAL_DMA_RSLT_ERR_NOT_SUPPORTED;
+    #else
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != scratch) && (size >= (2u * _MTB_HAL_DMA_MEM_CALIBRATE_MIN))),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == scratch) || (size < (2u * _MTB_HAL_DMA_MEM_CALIBRATE_MIN)))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    mtb_hal_dma_pool_stats_t stats;
+    mtb_hal_dma_pool_get_stats(&stats, false);
+    if (0u == (stats.channels[MTB_HAL_DMA_DW] + stats.channels[MTB_HAL_DMA_DMAC]))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_NOT_SUPPORTED;
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uint32_t half = (uint32_t)(size / 2u);
+    uint32_t threshold = UINT32_MAX;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    mtb_hal_dma_mem_xfer_t xfer;
+
+    /* Every copy below must be timed on the DMA, without touching the threshold other callers
+     * use meanwhile; a copy no channel is free for fails rather than running on the CPU */
+    for (uint32_t length = _MTB_HAL_DMA_MEM_CALIBRATE_MIN;
+         (length <= half) && (CY_RSLT_SUCCESS == result); length <<= 1u)
+    {
+        uint32_t start = DWT->CYCCNT;
+        (void)memcpy(&scratch[half], scratch, length);
+        uint32_t cpu_cycles = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        _mtb_hal_dma_mem_set_copy(&xfer, &scratch[half], scratch, length);
+        result = _mtb_hal_dma_mem_submit(&xfer, length, 0u, true, NULL, NULL);
+        while ((CY_RSLT_SUCCESS == result) &&
+               (MTB_HAL_DMA_RSLT_WARN_IN_PROGRESS == mtb_hal_dma_mem_get_status(&xfer)))
+        {
+        }
+        uint32_t dma_cycles = DWT->CYCCNT - start;
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = mtb_hal_dma_mem_get_status(&xfer);
+        }
+        if ((CY_RSLT_SUCCESS == result) && (dma_cycles <= cpu_cycles))
+        {
+            threshold = length;
+            break;
+        }
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        _mtb_hal_dma_mem_threshold = threshold;
+    }
+    return result;
+    #endif /* (CY_CPU_CORTEX_M0P) */
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_mem_set_threshold
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_dma_mem_set_threshold(uint32_t bytes)
+{
+    _mtb_hal_dma_mem_threshold = bytes;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_mem_get_threshold
+//--------------------------------------------------------------------------------------------------
+uint32_t mtb_hal_dma_mem_get_threshold(void)
+{
+    return _mtb_hal_dma_mem_threshold;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_mem_copy
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_mem_copy(mtb_hal_dma_mem_xfer_t* xfer, void* dst, const void* src,
+                               size_t length, mtb_hal_dma_mem_callback_t callback,
+                               void* callback_arg)
+{
+    CY_ASSERT(NULL != xfer);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != dst) && (NULL != src) && (0u != length)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == dst) || (NULL == src) || (0u == length))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+
+    _mtb_hal_dma_mem_set_copy(xfer, dst, src, length);
+    return _mtb_hal_dma_mem_submit(xfer, (uint32_t)length, _mtb_hal_dma_mem_threshold, false,
+                                   callback, callback_arg);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_mem_fill
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_mem_fill(mtb_hal_dma_mem_xfer_t* xfer, void* dst, uint8_t value,
+                               size_t length, mtb_hal_dma_mem_callback_t callback,
+                               void* callback_arg)
+{
+    CY_ASSERT(NULL != xfer);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != dst) && (0u != length)), MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == dst) || (0u == length))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+
+    uint8_t data_size = (0u == (((uint32_t)dst | (uint32_t)length) & 3u)) ? 2u : 0u;
+    _mtb_hal_dma_mem_descr_t* descr = &(xfer->descr);
+    /* The source is the fill value held in the transfer state, read again for every element */
+    xfer->pattern = 0x01010101u * value;
+    descr->src = (uint32_t)&(xfer->pattern);
+    descr->dst = (uint32_t)dst;
+    descr->data_size = data_size;
+    descr->x_count = (uint32_t)length >> data_size;
+    descr->x_src_inc = 0;
+    descr->x_dst_inc = 1;
+    descr->y_src_inc = 0;
+    descr->y_dst_inc = 0;
+    xfer->rows = 1u;
+    xfer->src_addr = 0u;
+    xfer->src_span = 0u;
+    xfer->dst_addr = (uint32_t)dst;
+    xfer->dst_span = (uint32_t)length;
+    return _mtb_hal_dma_mem_submit(xfer, (uint32_t)length, _mtb_hal_dma_mem_threshold, false,
+                                   callback, callback_arg);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_mem_copy_2d
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_mem_copy_2d(mtb_hal_dma_mem_xfer_t* xfer, void* dst, uint32_t dst_stride,
+                                  const void* src, uint32_t src_stride, uint32_t width,
+                                  uint32_t height, mtb_hal_dma_mem_callback_t callback,
+                                  void* callback_arg)
+{
+    CY_ASSERT(NULL != xfer);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != dst) && (NULL != src) && (0u != width) && (0u != height) &&
+                          (dst_stride >= width) && (src_stride >= width)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((NULL == dst) || (NULL == src) || (0u == width) || (0u == height) ||
+        (dst_stride < width) || (src_stride < width))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+
+    uint8_t data_size = (0u == (((uint32_t)dst | (uint32_t)src | dst_stride | src_stride | width) &
+                                3u)) ? 2u : 0u;
+    _mtb_hal_dma_mem_descr_t* descr = &(xfer->descr);
+    descr->src = (uint32_t)src;
+    descr->dst = (uint32_t)dst;
+    descr->data_size = data_size;
+    descr->x_count = width >> data_size;
+    descr->x_src_inc = 1;
+    descr->x_dst_inc = 1;
+    descr->y_src_inc = (int32_t)(src_stride >> data_size);
+    descr->y_dst_inc = (int32_t)(dst_stride >> data_size);
+    xfer->rows = height;
+    xfer->src_addr = (uint32_t)src;
+    xfer->src_span = ((height - 1u) * src_stride) + width;
+    xfer->dst_addr = (uint32_t)dst;
+    xfer->dst_span = ((height - 1u) * dst_stride) + width;
+    return _mtb_hal_dma_mem_submit(xfer, width * height, _mtb_hal_dma_mem_threshold, false,
+                                   callback, callback_arg);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_mem_get_status
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_mem_get_status(const mtb_hal_dma_mem_xfer_t* xfer)
+{
+    CY_ASSERT(NULL != xfer);
+    return xfer->status;
+}
+
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
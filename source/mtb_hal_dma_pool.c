@@ -0,0 +1,286 @@
+/***************************************************************************//**
+* \file mtb_hal_dma_pool.c
+*
+* \brief
+* Implements a pool of DMA channels of both DMA types that users allocate for
+* the duration of a transfer.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024-2025 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+#include "mtb_hal_dma.h"
+#include "mtb_hal_system.h"
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+
+#if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+#include "mtb_hal_dma_dmac.h"
+#endif
+#if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+#include "mtb_hal_dma_dw.h"
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/* Channels lent to the pool, linked through pool_next. A channel is allocated while its
+   pool_used is set. Both, and the statistics, only change inside a critical section. */
+static mtb_hal_dma_t* _mtb_hal_dma_pool_channels = NULL;
+static mtb_hal_dma_pool_stats_t _mtb_hal_dma_pool_stats;
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_pool_find
+//--------------------------------------------------------------------------------------------------
+/* Returns the first free channel of a DMA type. Must be called inside a critical section. */
+static mtb_hal_dma_t* _mtb_hal_dma_pool_find(mtb_hal_dma_type_t dma_type)
+{
+    mtb_hal_dma_t* channel = _mtb_hal_dma_pool_channels;
+    while ((NULL != channel) && (channel->pool_used || (dma_type != channel->dma_type)))
+    {
+        channel = channel->pool_next;
+    }
+    return channel;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_pool_set_priority
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_dma_pool_set_priority(mtb_hal_dma_t* obj, uint8_t priority)
+{
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW)
+    if (MTB_HAL_DMA_DW == obj->dma_type)
+    {
+        _mtb_hal_dma_dw_set_priority(obj, priority);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DW) */
+    #if (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC)
+    if (MTB_HAL_DMA_DMAC == obj->dma_type)
+    {
+        _mtb_hal_dma_dmac_set_priority(obj, priority);
+    }
+    #endif /* (_MTB_HAL_DRIVER_AVAILABLE_DMA_DMAC) */
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_dma_pool_reset
+//--------------------------------------------------------------------------------------------------
+/* Leaves a channel disabled and silent, as it is expected to be when allocated */
+static cy_rslt_t _mtb_hal_dma_pool_reset(mtb_hal_dma_t* obj)
+{
+    cy_rslt_t result = mtb_hal_dma_disable(obj);
+    mtb_hal_dma_enable_event(obj, (mtb_hal_dma_event_t)~0u, false);
+    mtb_hal_dma_register_callback(obj, NULL, NULL);
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_pool_add_channel
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_pool_add_channel(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((MTB_HAL_DMA_DW == obj->dma_type) ||
+                          (MTB_HAL_DMA_DMAC == obj->dma_type)),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((MTB_HAL_DMA_DW != obj->dma_type) && (MTB_HAL_DMA_DMAC != obj->dma_type))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+    if (mtb_hal_dma_is_busy(obj))
+    {
+        return MTB_HAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
+    }
+
+    cy_rslt_t result = _mtb_hal_dma_pool_reset(obj);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+        mtb_hal_dma_t* channel = _mtb_hal_dma_pool_channels;
+        while ((NULL != channel) && (obj != channel))
+        {
+            channel = channel->pool_next;
+        }
+        /* Lending a channel twice leaves it in the pool once */
+        if (NULL == channel)
+        {
+            obj->pool_used = false;
+            obj->pool_next = _mtb_hal_dma_pool_channels;
+            _mtb_hal_dma_pool_channels = obj;
+            ++_mtb_hal_dma_pool_stats.channels[obj->dma_type];
+        }
+        mtb_hal_system_critical_section_exit(savedIntrStatus);
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_pool_remove_channel
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_pool_remove_channel(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    cy_rslt_t result = MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (obj->pool_used)
+    {
+        result = MTB_HAL_DMA_RSLT_WARN_IN_PROGRESS;
+    }
+    else
+    {
+        mtb_hal_dma_t** link = &_mtb_hal_dma_pool_channels;
+        while ((NULL != *link) && (obj != *link))
+        {
+            link = &((*link)->pool_next);
+        }
+        if (NULL != *link)
+        {
+            *link = obj->pool_next;
+            obj->pool_next = NULL;
+            --_mtb_hal_dma_pool_stats.channels[obj->dma_type];
+            result = CY_RSLT_SUCCESS;
+        }
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_pool_alloc
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_pool_alloc(mtb_hal_dma_t** obj, uint8_t priority,
+                                 mtb_hal_dma_type_t preferred, bool fallback)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((priority <= MTB_HAL_DMA_PRIORITY_LOWEST) &&
+                          ((MTB_HAL_DMA_DW == preferred) || (MTB_HAL_DMA_DMAC == preferred))),
+                         MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if ((priority > MTB_HAL_DMA_PRIORITY_LOWEST) ||
+        ((MTB_HAL_DMA_DW != preferred) && (MTB_HAL_DMA_DMAC != preferred)))
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+
+    mtb_hal_dma_pool_stats_t* stats = &_mtb_hal_dma_pool_stats;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    mtb_hal_dma_t* channel = _mtb_hal_dma_pool_find(preferred);
+    if ((NULL == channel) && fallback)
+    {
+        channel = _mtb_hal_dma_pool_find((MTB_HAL_DMA_DW == preferred)
+                                         ? MTB_HAL_DMA_DMAC : MTB_HAL_DMA_DW);
+        if (NULL != channel)
+        {
+            ++stats->fallbacks;
+        }
+    }
+    if (NULL != channel)
+    {
+        channel->pool_used = true;
+        ++stats->allocations;
+        ++stats->in_use[channel->dma_type];
+        if (stats->in_use[channel->dma_type] > stats->in_use_max[channel->dma_type])
+        {
+            stats->in_use_max[channel->dma_type] = stats->in_use[channel->dma_type];
+        }
+    }
+    else
+    {
+        ++stats->failures;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    *obj = channel;
+    if (NULL == channel)
+    {
+        return MTB_HAL_DMA_RSLT_WARN_NO_CHANNEL;
+    }
+    /* Free channels are disabled, so the priority can be changed */
+    _mtb_hal_dma_pool_set_priority(channel, priority);
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_pool_free
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_dma_pool_free(mtb_hal_dma_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(obj->pool_used, MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER);
+    #else
+    if (!obj->pool_used)
+    {
+        return MTB_HAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+    #endif
+
+    cy_rslt_t result = _mtb_hal_dma_pool_reset(obj);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->pool_used = false;
+    --_mtb_hal_dma_pool_stats.in_use[obj->dma_type];
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_dma_pool_get_stats
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_dma_pool_get_stats(mtb_hal_dma_pool_stats_t* stats, bool reset)
+{
+    CY_ASSERT(NULL != stats);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    *stats = _mtb_hal_dma_pool_stats;
+    if (reset)
+    {
+        _mtb_hal_dma_pool_stats.allocations = 0u;
+        _mtb_hal_dma_pool_stats.fallbacks = 0u;
+        _mtb_hal_dma_pool_stats.failures = 0u;
+        (void)memcpy(_mtb_hal_dma_pool_stats.in_use_max, _mtb_hal_dma_pool_stats.in_use,
+                     sizeof(_mtb_hal_dma_pool_stats.in_use_max));
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
@@ -30,6 +30,7 @@
 #include "mtb_hal_i2c.h"
 #include "mtb_hal_system.h"
 #include "mtb_hal_utils.h"
+#include "mtb_hal_scb_common.h"
 
 #if   defined(CY_IP_MXSCB) && (CY_IP_MXSCB_VERSION == 1)
 #include "mtb_hal_i2c_mxs22scb_v1.h"
@@ -84,38 +85,56 @@ extern "C"
    target frequency. This is not a limitation that is required per the I2C standard */
 #define _MTB_HAL_I2C_CLK_DIV_TOLERANCE_PPM        (50000)
 
+/* SCB clocks in each SCL phase of a controller */
+#define _MTB_HAL_I2C_LOW_PHASE_MIN                (7U)
+#define _MTB_HAL_I2C_HIGH_PHASE_MIN               (5U)
+#define _MTB_HAL_I2C_PHASE_MAX                    (16U)
+/* SCB clocks between SCL crossing the input threshold and the SCB counting the high phase */
+#define _MTB_HAL_I2C_SCL_SYNC_CYCLES              (3U)
+
+/* Controller SCL timing for one I2C mode */
+typedef struct
+{
+    uint32_t data_rate;     /* Highest data rate of the mode */
+    uint32_t clock_min;     /* Lowest SCB clock the PDL accepts for a controller in the mode */
+    uint32_t clock_max;     /* Highest SCB clock the PDL accepts for a controller in the mode */
+    uint32_t clock_fixed;   /* SCB clock used when the divider cannot be searched */
+    uint16_t low_ns;        /* Minimum SCL low time */
+    uint16_t high_ns;       /* Minimum SCL high time */
+    uint16_t fall_ns;       /* Maximum SCL fall time */
+} _mtb_hal_i2c_mode_timing_t;
+
+static const _mtb_hal_i2c_mode_timing_t _mtb_hal_i2c_mode_timing[] =
+{
+    { CY_SCB_I2C_STD_DATA_RATE,  1550000UL,  3200000UL,  _MTB_HAL_SCB_PERI_CLOCK_CONTROLLER_STD,
+      4700U, 4000U, 300U },
+    { CY_SCB_I2C_FST_DATA_RATE,  7820000UL,  10000000UL, _MTB_HAL_SCB_PERI_CLOCK_CONTROLLER_FST,
+      1300U, 600U,  300U },
+    { CY_SCB_I2C_FSTP_DATA_RATE, 14320000UL, 25800000UL, _MTB_HAL_SCB_PERI_CLOCK_CONTROLLER_FSTP,
+      500U,  260U,  120U },
+};
+
 static const _mtb_hal_buffer_info_t _mtb_hal_i2c_buff_info_default =
 {
     .addr = { NULL },
     .size = 0,
 };
 
-/* Keep track of the current I2C object to ensure we are referencing the
- * correct one, as we don't directly pass the object through the PDL callback
- * indirection.  This also protects against a nested callback situation. */
-static volatile mtb_hal_i2c_t* _mtb_hal_i2c_irq_obj = NULL;
+/* Served when the controller reads past the end of a register map */
+static uint8_t _mtb_hal_i2c_regmap_pad = CY_SCB_I2C_DEFAULT_TX;
 
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_i2c_process_interrupt
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t mtb_hal_i2c_process_interrupt(mtb_hal_i2c_t* obj)
 {
-    /* Save the old value and store it aftewards in case we get into a nested IRQ situation */
-    /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in
-     * here, they just might change where the original pointer points */
-    mtb_hal_i2c_t* old_irq_obj = (mtb_hal_i2c_t*)_mtb_hal_i2c_irq_obj;
-
     if (NULL == obj)
     {
         return MTB_HAL_I2C_RSLT_ERR_BAD_ARGUMENT;  /* The interrupt object is not valid */
     }
 
-    _mtb_hal_i2c_irq_obj = obj;
-
     Cy_SCB_I2C_Interrupt(obj->base, obj->context);
 
-    _mtb_hal_i2c_irq_obj = old_irq_obj;
-
     #if defined(BCM55500)
     Cy_SCB_EnableInterrupt(obj->base);
     #endif /* defined(BCM55500) */
@@ -124,14 +143,205 @@ cy_rslt_t mtb_hal_i2c_process_interrupt(mtb_hal_i2c_t* obj)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_i2c_queue_issue
+//--------------------------------------------------------------------------------------------------
+/* Puts one phase of the transaction at the head of the queue on the bus. The write phase does not
+ * generate a Stop when a read follows, so the read starts with a repeated start. */
+static cy_rslt_t _mtb_hal_i2c_queue_issue(mtb_hal_i2c_t* obj, bool read)
+{
+    _mtb_hal_i2c_queue_t* queue = &(obj->queue);
+    mtb_hal_i2c_transaction_t* transaction = queue->storage[queue->head];
+    cy_stc_scb_i2c_master_xfer_config_t xfer_config;
+    cy_en_scb_i2c_status_t status;
+
+    xfer_config.slaveAddress = (uint8_t)transaction->address;
+    queue->read_phase = read || (0U == transaction->tx_size);
+    if (queue->read_phase)
+    {
+        xfer_config.buffer      = transaction->rx;
+        xfer_config.bufferSize  = transaction->rx_size;
+        xfer_config.xferPending = false;
+        status = Cy_SCB_I2C_MasterRead(obj->base, &xfer_config, obj->context);
+    }
+    else
+    {
+        xfer_config.buffer      = (uint8_t*)transaction->tx;
+        xfer_config.bufferSize  = transaction->tx_size;
+        xfer_config.xferPending = (0U != transaction->rx_size);
+        status = Cy_SCB_I2C_MasterWrite(obj->base, &xfer_config, obj->context);
+    }
+    return (cy_rslt_t)status;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_i2c_queue_complete
+//--------------------------------------------------------------------------------------------------
+/* Retires the transaction at the head of the queue. The next transaction is started before the
+ * callback runs so the bus does not sit idle while the application handles the result. */
+static void _mtb_hal_i2c_queue_complete(mtb_hal_i2c_t* obj, cy_rslt_t result)
+{
+    _mtb_hal_i2c_queue_t* queue = &(obj->queue);
+    while (0U != queue->count)
+    {
+        mtb_hal_i2c_transaction_t* done = queue->storage[queue->head];
+        queue->head = (uint8_t)((queue->head + 1U) % queue->size);
+        queue->count--;
+
+        cy_rslt_t next = (0U != queue->count)
+            ? _mtb_hal_i2c_queue_issue(obj, false)
+            : CY_RSLT_SUCCESS;
+
+        done->result = result;
+        done->complete = true;
+        if (NULL != done->callback)
+        {
+            done->callback(done->callback_arg, done);
+        }
+
+        if (CY_RSLT_SUCCESS == next)
+        {
+            break;
+        }
+        /* The next transaction could not be started, retire it too */
+        result = next;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_i2c_queue_event
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_i2c_queue_event(mtb_hal_i2c_t* obj, uint32_t event)
+{
+    _mtb_hal_i2c_queue_t* queue = &(obj->queue);
+    mtb_hal_i2c_transaction_t* transaction = queue->storage[queue->head];
+
+    if (0U != (event & CY_SCB_I2C_MASTER_ERR_EVENT))
+    {
+        _mtb_hal_i2c_queue_complete(obj, MTB_HAL_I2C_RSLT_ERR_TRANSACTION);
+    }
+    else if (!queue->read_phase && (0U != transaction->rx_size))
+    {
+        cy_rslt_t result = _mtb_hal_i2c_queue_issue(obj, true);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            _mtb_hal_i2c_queue_complete(obj, result);
+        }
+    }
+    else
+    {
+        _mtb_hal_i2c_queue_complete(obj, CY_RSLT_SUCCESS);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_i2c_regmap_notify
+//--------------------------------------------------------------------------------------------------
+/* Walks the regions overlapping registers [first, end). Written data is stored into writable
+ * regions; the application is told about each writable region written and each volatile region
+ * read. */
+static void _mtb_hal_i2c_regmap_notify(mtb_hal_i2c_t* obj, mtb_hal_i2c_regmap_event_t event,
+                                       uint32_t first, uint32_t end, const uint8_t* src)
+{
+    const mtb_hal_i2c_regmap_t* map = obj->regmap.map;
+    for (uint8_t i = 0U; i < map->region_count; i++)
+    {
+        const mtb_hal_i2c_reg_region_t* region = &(map->regions[i]);
+        bool match = (MTB_HAL_I2C_REGMAP_WRITE == event)
+            ? (MTB_HAL_I2C_REG_READ_ONLY != region->access)
+            : (MTB_HAL_I2C_REG_VOLATILE == region->access);
+        uint32_t lo = _MTB_HAL_MAX((uint32_t)region->start, first);
+        uint32_t hi = _MTB_HAL_MIN((uint32_t)region->start + region->count, end);
+        if (match && (lo < hi))
+        {
+            if (MTB_HAL_I2C_REGMAP_WRITE == event)
+            {
+                (void)memcpy(&(obj->regmap.data[lo]), &src[lo - first], hi - lo);
+            }
+            if (NULL != map->callback)
+            {
+                map->callback(map->callback_arg, event, (uint16_t)lo, (uint16_t)(hi - lo));
+            }
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_i2c_regmap_event
+//--------------------------------------------------------------------------------------------------
+/* Target side of the register map. Buffers are pointed at the map when a transaction starts, so
+ * reads are served by the PDL straight from the register values. */
+static void _mtb_hal_i2c_regmap_event(mtb_hal_i2c_t* obj, uint32_t event)
+{
+    const mtb_hal_i2c_regmap_t* map = obj->regmap.map;
+    uint32_t pointer = obj->regmap.pointer;
+
+    if (0U != (event & CY_SCB_I2C_SLAVE_WR_CMPLT_EVENT))
+    {
+        uint32_t count = Cy_SCB_I2C_SlaveGetWriteTransferCount(obj->base, obj->context);
+        /* A write without the register address only probes the device */
+        if (count >= map->address_bytes)
+        {
+            pointer = map->write_buffer[0];
+            if (2U == map->address_bytes)
+            {
+                pointer = (pointer << 8U) | map->write_buffer[1];
+            }
+            uint32_t end = _MTB_HAL_MIN(pointer + count - map->address_bytes, (uint32_t)map->size);
+            _mtb_hal_i2c_regmap_notify(obj, MTB_HAL_I2C_REGMAP_WRITE, pointer, end,
+                                       &(map->write_buffer[map->address_bytes]));
+            pointer = _MTB_HAL_MAX(pointer, end);
+        }
+        (void)Cy_SCB_I2C_SlaveClearWriteStatus(obj->base, obj->context);
+    }
+    if (0U != (event & CY_SCB_I2C_SLAVE_RD_CMPLT_EVENT))
+    {
+        uint32_t count = Cy_SCB_I2C_SlaveGetReadTransferCount(obj->base, obj->context);
+        uint32_t end = _MTB_HAL_MIN(pointer + count, (uint32_t)map->size);
+        _mtb_hal_i2c_regmap_notify(obj, MTB_HAL_I2C_REGMAP_READ, pointer, end, NULL);
+        pointer = _MTB_HAL_MAX(pointer, end);
+        (void)Cy_SCB_I2C_SlaveClearReadStatus(obj->base, obj->context);
+    }
+    obj->regmap.pointer = (uint16_t)_MTB_HAL_MIN(pointer, (uint32_t)map->size);
+
+    if (0U != (event & CY_SCB_I2C_SLAVE_WRITE_EVENT))
+    {
+        Cy_SCB_I2C_SlaveConfigWriteBuf(obj->base, map->write_buffer, map->write_buffer_size,
+                                       obj->context);
+    }
+    if (0U != (event & CY_SCB_I2C_SLAVE_READ_EVENT))
+    {
+        if (obj->regmap.pointer < map->size)
+        {
+            Cy_SCB_I2C_SlaveConfigReadBuf(obj->base, &(obj->regmap.data[obj->regmap.pointer]),
+                                          (uint32_t)map->size - obj->regmap.pointer,
+                                          obj->context);
+        }
+        else
+        {
+            Cy_SCB_I2C_SlaveConfigReadBuf(obj->base, &_mtb_hal_i2c_regmap_pad, 1UL, obj->context);
+        }
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_i2c_cb_wrapper
 //--------------------------------------------------------------------------------------------------
-static void _mtb_hal_i2c_cb_wrapper(uint32_t event)
+/* Target events are delivered as they occur rather than per interrupt pass, because the user may
+   have to supply a buffer before the PDL continues with the transfer */
+static void _mtb_hal_i2c_cb_wrapper(void* cb_obj, uint32_t event)
 {
-    /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in
-       here, they just might change where the original pointer points */
-    mtb_hal_i2c_t* obj = (mtb_hal_i2c_t*)_mtb_hal_i2c_irq_obj;
+    mtb_hal_i2c_t* obj = (mtb_hal_i2c_t*)cb_obj;
+    if (NULL != obj->regmap.map)
+    {
+        _mtb_hal_i2c_regmap_event(obj, event);
+    }
+
     if ((mtb_hal_i2c_event_t)(obj->irq_cause & event))
     {
         /* Indicates read/write operations will be in a callback */
@@ -142,17 +352,22 @@ static void _mtb_hal_i2c_cb_wrapper(uint32_t event)
         callback(obj->callback_data.callback_arg, (mtb_hal_i2c_event_t)(obj->irq_cause & event));
         obj->op_in_callback = false;
     }
+
+    if ((0U != obj->queue.count) &&
+        (0U != (event & (CY_SCB_I2C_MASTER_WR_CMPLT_EVENT | CY_SCB_I2C_MASTER_RD_CMPLT_EVENT |
+                         CY_SCB_I2C_MASTER_ERR_EVENT))))
+    {
+        _mtb_hal_i2c_queue_event(obj, event);
+    }
 }
 
 
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_i2c_cb_addr_wrapper
 //--------------------------------------------------------------------------------------------------
-static cy_en_scb_i2c_command_t _mtb_hal_i2c_cb_addr_wrapper(uint32_t event)
+static cy_en_scb_i2c_command_t _mtb_hal_i2c_cb_addr_wrapper(void* cb_obj, uint32_t event)
 {
-    /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in
-       here, they just might change where the original pointer points */
-    mtb_hal_i2c_t* obj = (mtb_hal_i2c_t*)_mtb_hal_i2c_irq_obj;
+    mtb_hal_i2c_t* obj = (mtb_hal_i2c_t*)cb_obj;
     mtb_hal_i2c_addr_event_t addr_events =
         (mtb_hal_i2c_addr_event_t)(obj->addr_irq_cause & event);
     uint8_t device_address = 0;
@@ -304,6 +519,178 @@ cy_rslt_t _mtb_hal_i2c_set_peri_divider(void* obj, uint32_t freq, bool is_target
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_i2c_solve_phases
+//--------------------------------------------------------------------------------------------------
+/* Picks the SCL low and high phases for an SCB clock. The phases start at the shortest that meet
+ * the required low and high times and are lengthened until the SCL period, including the rise
+ * time, is no shorter than one bit at the requested rate. Returns the data rate achieved, or 0 if
+ * the clock cannot meet the requirements. */
+static uint32_t _mtb_hal_i2c_solve_phases(uint32_t clock_hz, uint32_t freq, uint32_t rise_ns,
+                                          uint32_t fall_ns, uint32_t low_ns, uint32_t high_ns,
+                                          mtb_hal_i2c_timing_t* timing)
+{
+    const uint64_t ns_per_s = (uint64_t)_MTB_HAL_UTILS_NS_PER_SECOND;
+    uint32_t low = (uint32_t)((((uint64_t)(low_ns + fall_ns) * clock_hz) + ns_per_s - 1U) /
+                              ns_per_s);
+    uint32_t high = (uint32_t)((((uint64_t)high_ns * clock_hz) + ns_per_s - 1U) / ns_per_s);
+    low = _MTB_HAL_MAX(low, _MTB_HAL_I2C_LOW_PHASE_MIN);
+    high = _MTB_HAL_MAX(high, _MTB_HAL_I2C_HIGH_PHASE_MIN);
+
+    /* SCB clocks per bit left once the rise time is taken out, rounded up */
+    uint64_t scaled = (uint64_t)freq * ns_per_s;
+    uint32_t cycles = (uint32_t)((((uint64_t)clock_hz * (ns_per_s - ((uint64_t)freq * rise_ns))) +
+                                  scaled - 1U) / scaled);
+    uint32_t phases = (cycles > _MTB_HAL_I2C_SCL_SYNC_CYCLES)
+        ? (cycles - _MTB_HAL_I2C_SCL_SYNC_CYCLES)
+        : 0U;
+
+    while (((low + high) < phases) &&
+           ((low < _MTB_HAL_I2C_PHASE_MAX) || (high < _MTB_HAL_I2C_PHASE_MAX)))
+    {
+        if (((high < low) && (high < _MTB_HAL_I2C_PHASE_MAX)) || (low >= _MTB_HAL_I2C_PHASE_MAX))
+        {
+            ++high;
+        }
+        else
+        {
+            ++low;
+        }
+    }
+    if ((low > _MTB_HAL_I2C_PHASE_MAX) || (high > _MTB_HAL_I2C_PHASE_MAX) ||
+        ((low + high) < phases))
+    {
+        return 0U;
+    }
+
+    uint32_t low_time = (uint32_t)(((uint64_t)low * ns_per_s) / clock_hz) - fall_ns;
+    uint32_t high_time = (uint32_t)(((uint64_t)high * ns_per_s) / clock_hz);
+    timing->clock_hz = clock_hz;
+    timing->low_cycles = (uint8_t)low;
+    timing->high_cycles = (uint8_t)high;
+    timing->low_margin_ns = (uint16_t)_MTB_HAL_MIN(low_time - low_ns, UINT16_MAX);
+    timing->high_margin_ns = (uint16_t)_MTB_HAL_MIN(high_time - high_ns, UINT16_MAX);
+    timing->data_rate_hz = (uint32_t)(((uint64_t)clock_hz * ns_per_s) /
+                                      (((uint64_t)(low + high + _MTB_HAL_I2C_SCL_SYNC_CYCLES) *
+                                        ns_per_s) + ((uint64_t)rise_ns * clock_hz)));
+    return timing->data_rate_hz;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_i2c_set_controller_timing
+//--------------------------------------------------------------------------------------------------
+/* Chooses the SCB clock and the SCL phases giving the highest data rate that does not exceed the
+ * requested one. When the clock is a peripheral divider, the divider closest to each possible
+ * number of SCB clocks per bit is tried. Configuration of clock is not changed if driver does not
+ * own it. */
+static cy_rslt_t _mtb_hal_i2c_set_controller_timing(mtb_hal_i2c_t* obj,
+                                                    const mtb_hal_i2c_cfg_t* cfg)
+{
+    CySCB_Type* base = obj->base;
+    const mtb_hal_clock_t* clock = obj->clock;
+    const _mtb_hal_i2c_mode_timing_t* mode = NULL;
+    uint32_t freq = cfg->frequency_hz;
+
+    for (size_t i = 0U; i < (sizeof(_mtb_hal_i2c_mode_timing) /
+                             sizeof(_mtb_hal_i2c_mode_timing[0])); i++)
+    {
+        if (freq <= _mtb_hal_i2c_mode_timing[i].data_rate)
+        {
+            mode = &_mtb_hal_i2c_mode_timing[i];
+            break;
+        }
+    }
+    /* The rise time alone must leave room for the bit */
+    if ((NULL == mode) ||
+        (((uint64_t)freq * cfg->rise_time_ns) >= (uint64_t)_MTB_HAL_UTILS_NS_PER_SECOND))
+    {
+        return MTB_HAL_I2C_RSLT_ERR_CAN_NOT_REACH_DR;
+    }
+
+    uint32_t low_ns = _MTB_HAL_MAX(mode->low_ns, cfg->min_low_ns);
+    uint32_t high_ns = _MTB_HAL_MAX(mode->high_ns, cfg->min_high_ns);
+    mtb_hal_i2c_timing_t best = { 0 };
+    mtb_hal_i2c_timing_t candidate;
+    uint32_t best_divider = 0U;
+    uint32_t original_freq = clock->interface->get_frequency_hz(clock->clock_ref);
+    uint32_t original_data_rate = Cy_SCB_I2C_GetDataRate(base, original_freq);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if (&mtb_hal_clock_peri_interface == clock->interface)
+    {
+        const mtb_hal_peri_div_t* div = (const mtb_hal_peri_div_t*)clock->clock_ref;
+        uint32_t source_freq = mtb_hal_clock_get_peri_src_clock_freq(div);
+        uint64_t bit_ns = (uint64_t)_MTB_HAL_UTILS_NS_PER_SECOND - ((uint64_t)freq *
+                                                                    cfg->rise_time_ns);
+        for (uint32_t cycles = _MTB_HAL_I2C_LOW_PHASE_MIN + _MTB_HAL_I2C_HIGH_PHASE_MIN;
+             cycles <= (2U * _MTB_HAL_I2C_PHASE_MAX); cycles++)
+        {
+            /* SCB clock fitting this many clocks per bit once the rise time is taken out */
+            uint32_t ideal = (uint32_t)(((uint64_t)(cycles + _MTB_HAL_I2C_SCL_SYNC_CYCLES) * freq *
+                                         (uint64_t)_MTB_HAL_UTILS_NS_PER_SECOND) / bit_ns);
+            uint32_t divider;
+            uint32_t clock_hz = _mtb_hal_clock_calc_peri_div(source_freq, div->div_type, ideal,
+                                                             &divider);
+            if ((clock_hz >= mode->clock_min) && (clock_hz <= mode->clock_max) &&
+                (_mtb_hal_i2c_solve_phases(clock_hz, freq, cfg->rise_time_ns, mode->fall_ns,
+                                           low_ns, high_ns, &candidate) > best.data_rate_hz))
+            {
+                best = candidate;
+                best_divider = divider;
+            }
+        }
+        if (0U == best.data_rate_hz)
+        {
+            result = MTB_HAL_I2C_RSLT_ERR_CAN_NOT_REACH_DR;
+        }
+        else
+        {
+            _mtb_hal_clock_set_peri_div(div, best_divider);
+        }
+    }
+    else
+    {
+        result = clock->interface->set_frequency_hz(clock->clock_ref, mode->clock_fixed,
+                                                    _MTB_HAL_I2C_CLK_DIV_TOLERANCE_PPM);
+        if ((CY_RSLT_SUCCESS == result) &&
+            (0U == _mtb_hal_i2c_solve_phases(
+                 clock->interface->get_frequency_hz(clock->clock_ref), freq, cfg->rise_time_ns,
+                 mode->fall_ns, low_ns, high_ns, &best)))
+        {
+            result = MTB_HAL_I2C_RSLT_ERR_CAN_NOT_REACH_DR;
+        }
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        /* The PDL sets up the filters for the mode; its phases are then replaced */
+        if (0U == Cy_SCB_I2C_SetDataRate(base, freq, best.clock_hz))
+        {
+            result = MTB_HAL_I2C_RSLT_ERR_CAN_NOT_REACH_DR;
+        }
+        else
+        {
+            Cy_SCB_I2C_MasterSetLowPhaseDutyCycle(base, best.low_cycles);
+            Cy_SCB_I2C_MasterSetHighPhaseDutyCycle(base, best.high_cycles);
+            if (NULL != cfg->timing)
+            {
+                *(cfg->timing) = best;
+            }
+        }
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        /* Revert clocks */
+        clock->interface->set_frequency_hz(clock->clock_ref, original_freq,
+                                           _MTB_HAL_I2C_CLK_DIV_TOLERANCE_PPM);
+        Cy_SCB_I2C_SetDataRate(base, original_data_rate, original_freq);
+    }
+    return result;
+}
+
+
 /* Start API implementing */
 cy_rslt_t mtb_hal_i2c_setup(mtb_hal_i2c_t* obj, const mtb_hal_i2c_configurator_t* config,
                             cy_stc_scb_i2c_context_t* context, mtb_hal_clock_t* clock)
@@ -322,6 +709,9 @@ cy_rslt_t mtb_hal_i2c_setup(mtb_hal_i2c_t* obj, const mtb_hal_i2c_configurator_t
     obj->rx_target_buff = _mtb_hal_i2c_buff_info_default;
     obj->tx_target_buff = _mtb_hal_i2c_buff_info_default;
 
+    memset(&(obj->queue), 0, sizeof(obj->queue));
+    memset(&(obj->regmap), 0, sizeof(obj->regmap));
+
     return CY_RSLT_SUCCESS;
 }
 
@@ -355,7 +745,9 @@ cy_rslt_t mtb_hal_i2c_configure(mtb_hal_i2c_t* obj, const mtb_hal_i2c_cfg_t* cfg
     cy_rslt_t result = (cy_rslt_t)Cy_SCB_I2C_Init(obj->base, &_config_structure, obj->context);
     if ((CY_RSLT_SUCCESS == result) && (cfg->frequency_hz != 0))
     {
-        result  = _mtb_hal_i2c_set_peri_divider((void*)obj, cfg->frequency_hz, cfg->is_target);
+        result = (cfg->is_target)
+            ? _mtb_hal_i2c_set_peri_divider((void*)obj, cfg->frequency_hz, true)
+            : _mtb_hal_i2c_set_controller_timing(obj, cfg);
     }
 
     /* Revert back to original configuration */
@@ -378,6 +770,11 @@ static cy_rslt_t _mtb_hal_i2c_controller_read_write(mtb_hal_i2c_t* obj, uint16_t
                                                     uint32_t timeout, bool send_stop,
                                                     cy_en_scb_i2c_direction_t direction)
 {
+    if (0U != obj->queue.count)
+    {
+        return MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+    }
+
     cy_en_scb_i2c_command_t ack = CY_SCB_I2C_ACK;
 
     cy_en_scb_i2c_status_t status = (obj->context->state == CY_SCB_I2C_IDLE)
@@ -444,6 +841,225 @@ cy_rslt_t mtb_hal_i2c_controller_read(mtb_hal_i2c_t* obj, uint16_t dev_addr, uin
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_i2c_queue_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_i2c_queue_start(mtb_hal_i2c_t* obj, mtb_hal_i2c_transaction_t** storage,
+                                  uint8_t size)
+{
+    CY_ASSERT(NULL != obj);
+
+    if ((NULL == storage) || (0U == size))
+    {
+        return MTB_HAL_I2C_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if (0U != obj->queue.count)
+    {
+        return MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+    }
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->queue.storage    = storage;
+    obj->queue.size       = size;
+    obj->queue.head       = 0U;
+    obj->queue.read_phase = false;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    /* Completion events are delivered through the event callback wrapper */
+    Cy_SCB_I2C_RegisterEventCallback(obj->base,
+                                     _mtb_hal_scb_bind_event(obj->base, obj,
+                                                             _mtb_hal_i2c_cb_wrapper),
+                                     obj->context);
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_i2c_queue_submit
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_i2c_queue_submit(mtb_hal_i2c_t* obj, mtb_hal_i2c_transaction_t* transaction)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != transaction);
+
+    _mtb_hal_i2c_queue_t* queue = &(obj->queue);
+    if ((NULL == queue->storage) ||
+        ((0U == transaction->tx_size) && (0U == transaction->rx_size)) ||
+        ((0U != transaction->tx_size) && (NULL == transaction->tx)) ||
+        ((0U != transaction->rx_size) && (NULL == transaction->rx)))
+    {
+        return MTB_HAL_I2C_RSLT_ERR_BAD_ARGUMENT;
+    }
+
+    transaction->complete = false;
+    transaction->result = CY_RSLT_SUCCESS;
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (queue->count == queue->size)
+    {
+        result = MTB_HAL_I2C_RSLT_ERR_QUEUE_FULL;
+    }
+    else
+    {
+        queue->storage[(queue->head + queue->count) % queue->size] = transaction;
+        queue->count++;
+        if (1U == queue->count)
+        {
+            /* Bus is idle */
+            cy_rslt_t status = _mtb_hal_i2c_queue_issue(obj, false);
+            if (CY_RSLT_SUCCESS != status)
+            {
+                _mtb_hal_i2c_queue_complete(obj, status);
+            }
+        }
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    if ((CY_RSLT_SUCCESS == result) && transaction->complete)
+    {
+        /* Transaction could not be started */
+        result = transaction->result;
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_i2c_queue_get_count
+//--------------------------------------------------------------------------------------------------
+uint32_t mtb_hal_i2c_queue_get_count(mtb_hal_i2c_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->queue.count;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_i2c_queue_stop
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_i2c_queue_stop(mtb_hal_i2c_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    _mtb_hal_i2c_queue_t* queue = &(obj->queue);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (0U != queue->count)
+    {
+        if (queue->read_phase)
+        {
+            Cy_SCB_I2C_MasterAbortRead(obj->base, obj->context);
+        }
+        else
+        {
+            Cy_SCB_I2C_MasterAbortWrite(obj->base, obj->context);
+        }
+    }
+    /* Detach the queue so that no further transaction is started while retiring the pending ones */
+    mtb_hal_i2c_transaction_t** storage = queue->storage;
+    uint8_t size = queue->size;
+    uint8_t head = queue->head;
+    uint8_t count = queue->count;
+    queue->storage = NULL;
+    queue->count = 0U;
+    queue->read_phase = false;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        mtb_hal_i2c_transaction_t* done = storage[(head + i) % size];
+        done->result = MTB_HAL_I2C_RSLT_ERR_ABORTED;
+        done->complete = true;
+        if (NULL != done->callback)
+        {
+            done->callback(done->callback_arg, done);
+        }
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_i2c_target_regmap_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_i2c_target_regmap_start(mtb_hal_i2c_t* obj, const mtb_hal_i2c_regmap_t* map)
+{
+    CY_ASSERT(NULL != obj);
+
+    if ((NULL == map) || (NULL == map->data) || (0U == map->size) ||
+        ((1U != map->address_bytes) && (2U != map->address_bytes)) ||
+        ((1U == map->address_bytes) && (map->size > 256U)) ||
+        (NULL == map->write_buffer) || (map->write_buffer_size < map->address_bytes) ||
+        ((0U != map->region_count) && (NULL == map->regions)))
+    {
+        return MTB_HAL_I2C_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if (obj->context->state != CY_SCB_I2C_IDLE)
+    {
+        return MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+    }
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->regmap.map = map;
+    obj->regmap.data = map->data;
+    obj->regmap.pointer = 0U;
+    /* Buffers for the first transaction; later ones are pointed at the map as they start */
+    Cy_SCB_I2C_SlaveConfigWriteBuf(obj->base, map->write_buffer, map->write_buffer_size,
+                                   obj->context);
+    Cy_SCB_I2C_SlaveConfigReadBuf(obj->base, map->data, map->size, obj->context);
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    Cy_SCB_I2C_RegisterEventCallback(obj->base,
+                                     _mtb_hal_scb_bind_event(obj->base, obj,
+                                                             _mtb_hal_i2c_cb_wrapper),
+                                     obj->context);
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_i2c_target_regmap_set_bank
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_i2c_target_regmap_set_bank(mtb_hal_i2c_t* obj, uint8_t* data)
+{
+    CY_ASSERT(NULL != obj);
+
+    if ((NULL == obj->regmap.map) || (NULL == data))
+    {
+        return MTB_HAL_I2C_RSLT_ERR_BAD_ARGUMENT;
+    }
+    obj->regmap.data = data;
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_i2c_target_regmap_stop
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_i2c_target_regmap_stop(mtb_hal_i2c_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    cy_rslt_t result = MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    /* A transaction in progress still uses the map buffers */
+    if (obj->context->state == CY_SCB_I2C_IDLE)
+    {
+        obj->regmap.map = NULL;
+        obj->regmap.data = NULL;
+        /* Leave no map buffer with the PDL, it must not be written after the map is released */
+        Cy_SCB_I2C_SlaveConfigWriteBuf(obj->base, NULL, 0UL, obj->context);
+        Cy_SCB_I2C_SlaveConfigReadBuf(obj->base, NULL, 0UL, obj->context);
+        obj->rx_target_buff = _mtb_hal_i2c_buff_info_default;
+        obj->tx_target_buff = _mtb_hal_i2c_buff_info_default;
+        result = CY_RSLT_SUCCESS;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_i2c_target_abort_read
 //--------------------------------------------------------------------------------------------------
@@ -467,7 +1083,11 @@ cy_rslt_t mtb_hal_i2c_target_config_read_buffer(mtb_hal_i2c_t* obj, const uint8_
     if ((size > 0) && (data != NULL))
     #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
     {
-        if (obj->context->state == CY_SCB_I2C_IDLE)
+        if (NULL != obj->regmap.map)
+        {
+            result = MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+        }
+        else if (obj->context->state == CY_SCB_I2C_IDLE)
         {
             /* Note - 'WriteBuf' is intentional.  PDL and HAL buffer names are opposite */
             Cy_SCB_I2C_SlaveConfigWriteBuf(obj->base, (uint8_t*)data, size, obj->context);
@@ -496,7 +1116,11 @@ cy_rslt_t mtb_hal_i2c_target_config_write_buffer(mtb_hal_i2c_t* obj, uint8_t* da
     if ((size > 0) && (data != NULL))
     #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
     {
-        if (obj->context->state == CY_SCB_I2C_IDLE)
+        if (NULL != obj->regmap.map)
+        {
+            result = MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+        }
+        else if (obj->context->state == CY_SCB_I2C_IDLE)
         {
             /* Note - 'ReadBuf' is intentional.  PDL and HAL buffer names are opposite */
             Cy_SCB_I2C_SlaveConfigReadBuf(obj->base, (uint8_t*)data, size, obj->context);
@@ -521,6 +1145,11 @@ cy_rslt_t mtb_hal_i2c_target_read(mtb_hal_i2c_t* obj, uint8_t* dst_buff, uint16_
 {
     cy_rslt_t status = MTB_HAL_I2C_RSLT_ERR_BAD_ARGUMENT;
 
+    if (NULL != obj->regmap.map)
+    {
+        return MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+    }
+
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN(((obj->rx_target_buff.addr.u8 != NULL) &&
                           ((dst_buff != NULL) && (size != NULL))),
@@ -568,6 +1197,11 @@ cy_rslt_t mtb_hal_i2c_target_write(mtb_hal_i2c_t* obj, const uint8_t* src_buff,
 {
     cy_rslt_t status = MTB_HAL_I2C_RSLT_ERR_BAD_ARGUMENT;
 
+    if (NULL != obj->regmap.map)
+    {
+        return MTB_HAL_I2C_RSLT_WARN_DEVICE_BUSY;
+    }
+
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN((obj->tx_target_buff.addr.u8 != NULL) &&
                          ((src_buff != NULL) && (size != NULL)),
@@ -619,7 +1253,10 @@ void mtb_hal_i2c_register_callback(mtb_hal_i2c_t* obj, mtb_hal_i2c_event_callbac
     obj->callback_data.callback = (cy_israddress)callback;
     obj->callback_data.callback_arg = callback_arg;
     mtb_hal_system_critical_section_exit(savedIntrStatus);
-    Cy_SCB_I2C_RegisterEventCallback(obj->base, _mtb_hal_i2c_cb_wrapper, obj->context);
+    Cy_SCB_I2C_RegisterEventCallback(obj->base,
+                                     _mtb_hal_scb_bind_event(obj->base, obj,
+                                                             _mtb_hal_i2c_cb_wrapper),
+                                     obj->context);
 }
 
 
@@ -634,7 +1271,10 @@ void mtb_hal_i2c_register_address_callback(mtb_hal_i2c_t* obj,
     obj->addr_callback_data.callback = (cy_israddress)callback;
     obj->addr_callback_data.callback_arg = callback_arg;
     mtb_hal_system_critical_section_exit(savedIntrStatus);
-    Cy_SCB_I2C_RegisterAddrCallback(obj->base, _mtb_hal_i2c_cb_addr_wrapper, obj->context);
+    Cy_SCB_I2C_RegisterAddrCallback(obj->base,
+                                    _mtb_hal_scb_bind_addr(obj->base, obj,
+                                                           _mtb_hal_i2c_cb_addr_wrapper),
+                                    obj->context);
 }
 
 
@@ -61,6 +61,9 @@
 #include "mtb_hal_utils.h"
 #include "mtb_hal_memoryspi.h"
 #include "mtb_hal_system_impl.h"
+#if defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+#include "mtb_hal_timer.h"
+#endif
 
 #if (MTB_HAL_DRIVER_AVAILABLE_MEMORYSPI)
 
@@ -75,6 +78,11 @@ extern "C" {
 #define _MTB_HAL_MEMORYSPI_TIMEOUT_10_MS (10000UL)
 /* max number of bytes that the SMIF can drive in one operation */
 #define _MTB_HAL_MEMORYSPI_MAX_RX_COUNT (65536UL)
+/* read cache line flags, kept in the low bits of the line address */
+#define _MTB_HAL_MEMORYSPI_CACHE_VALID      (1UL << 0)
+#define _MTB_HAL_MEMORYSPI_CACHE_PREFETCHED (1UL << 1)
+#define _MTB_HAL_MEMORYSPI_CACHE_FLAGS      \
+    (_MTB_HAL_MEMORYSPI_CACHE_VALID | _MTB_HAL_MEMORYSPI_CACHE_PREFETCHED)
 
 
 /*******************************************************************************
@@ -86,6 +94,8 @@ extern "C" {
  * indirection.  This also protects against a nested callback situation. */
 static volatile mtb_hal_memoryspi_t* _mtb_hal_memoryspi_irq_obj = NULL;
 
+static void _mtb_hal_memoryspi_batch_step_done(mtb_hal_memoryspi_t* obj);
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_memoryspi_cb_wrapper
 //--------------------------------------------------------------------------------------------------
@@ -103,8 +113,22 @@ static void _mtb_hal_memoryspi_cb_wrapper(uint32_t event)
 
     mtb_hal_memoryspi_t* obj = (mtb_hal_memoryspi_t*)_mtb_hal_memoryspi_irq_obj;
 
-    if ((obj->enabled_events & (uint32_t)hal_event) > 0) // Make sure a user requested event is set
-                                                         // before calling
+    if (obj->cache.prefetch_busy && (event == CY_SMIF_REC_CMPLT))
+    {
+        /* Background line fill of the read cache finished, this is not a user transfer */
+        _mtb_hal_memoryspi_cache_t* cache = &(obj->cache);
+        cache->tags[2U * cache->prefetch_slot] = cache->prefetch_addr |
+                                                 _MTB_HAL_MEMORYSPI_CACHE_FLAGS;
+        cache->tags[(2U * cache->prefetch_slot) + 1U] = ++cache->use_stamp;
+        cache->prefetch_busy = false;
+    }
+    else if (obj->batch.active)
+    {
+        /* Data phase of a batch step finished, continue with the next step */
+        _mtb_hal_memoryspi_batch_step_done(obj);
+    }
+    else if ((obj->enabled_events & (uint32_t)hal_event) > 0) // Make sure a user requested event
+                                                              // is set before calling
     {
         mtb_hal_memoryspi_event_callback_t callback =
             (mtb_hal_memoryspi_event_callback_t)obj->callback_data.callback;
@@ -210,10 +234,134 @@ __STATIC_INLINE uint32_t _mtb_hal_memoryspi_get_size(mtb_hal_memoryspi_size_t ha
 }
 
 
-/* Sends MemorySPI command with certain set of data */
-static cy_rslt_t _mtb_hal_memoryspi_command_transfer(mtb_hal_memoryspi_t* obj,
-                                                     const mtb_hal_memoryspi_command_t* command,
-                                                     uint32_t addr, bool endOfTransfer)
+/*******************************************************************************
+*       (Internal) MemorySPI Read Cache
+*******************************************************************************/
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_cache_sync
+//--------------------------------------------------------------------------------------------------
+/* Waits for an outstanding prefetch, the bus cannot be reused before it completes */
+static cy_rslt_t _mtb_hal_memoryspi_cache_sync(mtb_hal_memoryspi_t* obj)
+{
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    uint32_t timeout = _MTB_HAL_MEMORYSPI_TIMEOUT_10_MS;
+    while (obj->cache.prefetch_busy && (CY_RSLT_SUCCESS == status))
+    {
+        /* Waiting for 1 us per iteration */
+        Cy_SysLib_DelayUs(1);
+        --timeout;
+        status = (0u == timeout) ? MTB_HAL_MEMORYSPI_RSLT_ERR_TIMEOUT : CY_RSLT_SUCCESS;
+    }
+    if (CY_RSLT_SUCCESS != status)
+    {
+        /* Completion was never reported, the line stays invalid */
+        obj->cache.prefetch_busy = false;
+    }
+    return status;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_cache_line
+//--------------------------------------------------------------------------------------------------
+__STATIC_INLINE uint8_t* _mtb_hal_memoryspi_cache_line(const _mtb_hal_memoryspi_cache_t* cache,
+                                                       uint32_t slot)
+{
+    return &(cache->storage[slot * cache->line_size]);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_cache_lookup
+//--------------------------------------------------------------------------------------------------
+/* Returns true and the slot holding line_addr if it is cached */
+static bool _mtb_hal_memoryspi_cache_lookup(const _mtb_hal_memoryspi_cache_t* cache,
+                                            uint32_t line_addr, uint32_t* slot)
+{
+    uint32_t first = ((line_addr / cache->line_size) & (cache->num_sets - 1U)) * cache->ways;
+    for (uint32_t i = first; i < (first + cache->ways); i++)
+    {
+        uint32_t tag = cache->tags[2U * i];
+        if ((0U != (tag & _MTB_HAL_MEMORYSPI_CACHE_VALID)) &&
+            ((tag & ~_MTB_HAL_MEMORYSPI_CACHE_FLAGS) == line_addr))
+        {
+            *slot = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_cache_victim
+//--------------------------------------------------------------------------------------------------
+/* Picks the slot to fill with line_addr: a free one, otherwise the least recently used one. The
+ * slot of an outstanding prefetch is only picked in a direct mapped cache, the caller's read then
+ * waits for the prefetch to land before overwriting it. */
+static uint32_t _mtb_hal_memoryspi_cache_victim(const _mtb_hal_memoryspi_cache_t* cache,
+                                                uint32_t line_addr)
+{
+    uint32_t first = ((line_addr / cache->line_size) & (cache->num_sets - 1U)) * cache->ways;
+    uint32_t victim = first;
+    uint32_t max_age = 0U;
+    for (uint32_t i = first; i < (first + cache->ways); i++)
+    {
+        if (cache->prefetch_busy && (i == cache->prefetch_slot) && (cache->ways > 1U))
+        {
+            continue;
+        }
+        if (0U == (cache->tags[2U * i] & _MTB_HAL_MEMORYSPI_CACHE_VALID))
+        {
+            victim = i;
+            break;
+        }
+        /* Distance from the current stamp keeps the order correct across stamp wrap-around */
+        uint32_t age = cache->use_stamp - cache->tags[(2U * i) + 1U];
+        if (age >= max_age)
+        {
+            max_age = age;
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_cache_invalidate_range
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_memoryspi_cache_invalidate_range(mtb_hal_memoryspi_t* obj, uint32_t address,
+                                                      size_t length)
+{
+    _mtb_hal_memoryspi_cache_t* cache = &(obj->cache);
+    if (NULL != cache->storage)
+    {
+        (void)_mtb_hal_memoryspi_cache_sync(obj);
+        uint32_t start = address & ~(cache->line_size - 1U);
+        uint32_t lines = cache->num_sets * cache->ways;
+        for (uint32_t i = 0U; i < lines; i++)
+        {
+            uint32_t tag = cache->tags[2U * i];
+            uint32_t line_addr = tag & ~_MTB_HAL_MEMORYSPI_CACHE_FLAGS;
+            if ((0U != (tag & _MTB_HAL_MEMORYSPI_CACHE_VALID)) &&
+                ((0U == length) ||
+                 ((line_addr >= start) && ((line_addr - start) < (length + (address - start))))))
+            {
+                cache->tags[2U * i] = 0U;
+                cache->invalidations++;
+            }
+        }
+    }
+}
+
+
+/* Sends MemorySPI command with certain set of data. The caller makes sure no prefetch is using
+   the bus. */
+static cy_rslt_t _mtb_hal_memoryspi_command_send(mtb_hal_memoryspi_t* obj,
+                                                 const mtb_hal_memoryspi_command_t* command,
+                                                 uint32_t addr, bool endOfTransfer)
 {
     /* max address size is 4 bytes and max mode bits size is 4 bytes */
     uint8_t cmd_param[8] = { 0 };
@@ -310,6 +458,20 @@ static cy_rslt_t _mtb_hal_memoryspi_command_transfer(mtb_hal_memoryspi_t* obj,
 }
 
 
+/* Sends MemorySPI command with certain set of data once an outstanding prefetch completed */
+static cy_rslt_t _mtb_hal_memoryspi_command_transfer(mtb_hal_memoryspi_t* obj,
+                                                     const mtb_hal_memoryspi_command_t* command,
+                                                     uint32_t addr, bool endOfTransfer)
+{
+    cy_rslt_t result = _mtb_hal_memoryspi_cache_sync(obj);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = _mtb_hal_memoryspi_command_send(obj, command, addr, endOfTransfer);
+    }
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_memoryspi_wait_for_cmd_fifo
 //--------------------------------------------------------------------------------------------------
@@ -494,13 +656,14 @@ cy_rslt_t mtb_hal_memoryspi_read(mtb_hal_memoryspi_t* obj,
 
 
 //--------------------------------------------------------------------------------------------------
-// mtb_hal_memoryspi_read_async
+// _mtb_hal_memoryspi_read_async
 //--------------------------------------------------------------------------------------------------
-cy_rslt_t mtb_hal_memoryspi_read_async(mtb_hal_memoryspi_t* obj,
-                                       const mtb_hal_memoryspi_command_t* command,
-                                       uint32_t address, void* data, size_t* length)
+static cy_rslt_t _mtb_hal_memoryspi_read_async(mtb_hal_memoryspi_t* obj,
+                                               const mtb_hal_memoryspi_command_t* command,
+                                               uint32_t address, void* data, size_t* length)
 {
-    cy_rslt_t status = _mtb_hal_memoryspi_command_transfer(obj, command, address, false);
+    /* Issues the read right away, also used to issue the prefetch itself */
+    cy_rslt_t status = _mtb_hal_memoryspi_command_send(obj, command, address, false);
 
     if (CY_RSLT_SUCCESS == status)
     {
@@ -553,6 +716,27 @@ cy_rslt_t mtb_hal_memoryspi_read_async(mtb_hal_memoryspi_t* obj,
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_read_async
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_memoryspi_read_async(mtb_hal_memoryspi_t* obj,
+                                       const mtb_hal_memoryspi_command_t* command,
+                                       uint32_t address, void* data, size_t* length)
+{
+    /* A batch owns the bus until it finishes */
+    if (obj->batch.active)
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY;
+    }
+    cy_rslt_t status = _mtb_hal_memoryspi_cache_sync(obj);
+    if (CY_RSLT_SUCCESS == status)
+    {
+        status = _mtb_hal_memoryspi_read_async(obj, command, address, data, length);
+    }
+    return status;
+}
+
+
 /* length can be up to 65536. */
 cy_rslt_t mtb_hal_memoryspi_write(mtb_hal_memoryspi_t* obj,
                                   const mtb_hal_memoryspi_command_t* command,
@@ -563,6 +747,11 @@ cy_rslt_t mtb_hal_memoryspi_write(mtb_hal_memoryspi_t* obj,
 
     if ((*length > 0))
     {
+        if (!command->address.disabled)
+        {
+            /* Cached copies of the written range are stale from now on */
+            _mtb_hal_memoryspi_cache_invalidate_range(obj, address, *length);
+        }
         status = _mtb_hal_memoryspi_command_transfer(obj, command, address, false);
 
         if (CY_RSLT_SUCCESS == status)
@@ -614,14 +803,20 @@ cy_rslt_t mtb_hal_memoryspi_write(mtb_hal_memoryspi_t* obj,
 
 
 /* length can be up to 65536. */
-cy_rslt_t mtb_hal_memoryspi_write_async(mtb_hal_memoryspi_t* obj,
-                                        const mtb_hal_memoryspi_command_t* command,
-                                        uint32_t address, const void* data, size_t* length)
+static cy_rslt_t _mtb_hal_memoryspi_write_async(mtb_hal_memoryspi_t* obj,
+                                                const mtb_hal_memoryspi_command_t* command,
+                                                uint32_t address, const void* data,
+                                                size_t* length)
 {
     cy_rslt_t status = CY_RSLT_SUCCESS;
 
     if ((*length > 0))
     {
+        if (!command->address.disabled)
+        {
+            /* Cached copies of the written range are stale from now on */
+            _mtb_hal_memoryspi_cache_invalidate_range(obj, address, *length);
+        }
         status = _mtb_hal_memoryspi_command_transfer(obj, command, address, false);
 
         if (CY_RSLT_SUCCESS == status)
@@ -673,6 +868,21 @@ cy_rslt_t mtb_hal_memoryspi_write_async(mtb_hal_memoryspi_t* obj,
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_write_async
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_memoryspi_write_async(mtb_hal_memoryspi_t* obj,
+                                        const mtb_hal_memoryspi_command_t* command,
+                                        uint32_t address, const void* data, size_t* length)
+{
+    if (obj->batch.active)
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY;
+    }
+    return _mtb_hal_memoryspi_write_async(obj, command, address, data, length);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_memoryspi_transfer
 //--------------------------------------------------------------------------------------------------
@@ -683,6 +893,11 @@ cy_rslt_t mtb_hal_memoryspi_transfer(
 {
     cy_rslt_t status = CY_RSLT_SUCCESS;
 
+    if (obj->batch.active)
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY;
+    }
+
     //Size for DDR operations needs to always be a multiple of 2
     if (((rx_size % 2) == 1) &&
         (command->instruction.data_rate == MTB_HAL_MEMORYSPI_DATARATE_DDR) &&
@@ -694,6 +909,11 @@ cy_rslt_t mtb_hal_memoryspi_transfer(
     if (((tx_data == NULL) || (tx_size == 0)) && ((rx_data == NULL) || (rx_size == 0)))
     {
         /* only command, no rx or tx */
+        if ((!command->address.disabled) && (NULL != obj->cache.storage))
+        {
+            /* Addressed command without data (e.g. erase) of unknown extent */
+            _mtb_hal_memoryspi_cache_invalidate_range(obj, address, 0U);
+        }
         status = _mtb_hal_memoryspi_command_transfer(obj, command, address, true);
     }
     else
@@ -715,6 +935,285 @@ cy_rslt_t mtb_hal_memoryspi_transfer(
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_batch_finish
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_memoryspi_batch_finish(mtb_hal_memoryspi_t* obj, cy_rslt_t result)
+{
+    obj->batch.result = result;
+    obj->batch.active = false;
+
+    if ((obj->enabled_events & (uint32_t)MTB_HAL_MEMORYSPI_IRQ_BATCH_DONE) > 0)
+    {
+        mtb_hal_memoryspi_event_callback_t callback =
+            (mtb_hal_memoryspi_event_callback_t)obj->callback_data.callback;
+        callback(obj->callback_data.callback_arg, MTB_HAL_MEMORYSPI_IRQ_BATCH_DONE);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_batch_issue
+//--------------------------------------------------------------------------------------------------
+/* Issues batch steps until one of them has a data phase in flight, whose completion calls back
+ * into _mtb_hal_memoryspi_batch_step_done. Steps may be issued from the SMIF interrupt, so they
+ * never wait for a prefetch: batches only start with the bus free of prefetches and no prefetch
+ * starts while one is active. A step that still finds one fails with BUSY. */
+static void _mtb_hal_memoryspi_batch_issue(mtb_hal_memoryspi_t* obj)
+{
+    _mtb_hal_memoryspi_batch_t* batch = &(obj->batch);
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    bool pending = false;
+
+    while ((!pending) && (CY_RSLT_SUCCESS == status) && (batch->index < batch->count))
+    {
+        const mtb_hal_memoryspi_batch_step_t* step = &(batch->steps[batch->index]);
+        size_t length = step->length;
+
+        if (obj->cache.prefetch_busy)
+        {
+            status = MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY;
+            break;
+        }
+
+        switch (step->op)
+        {
+            case MTB_HAL_MEMORYSPI_BATCH_COMMAND:
+                if (!step->command->address.disabled)
+                {
+                    _mtb_hal_memoryspi_cache_invalidate_range(obj, step->address, 0U);
+                }
+                status = _mtb_hal_memoryspi_command_transfer(obj, step->command, step->address,
+                                                             true);
+                batch->index++;
+                break;
+
+            case MTB_HAL_MEMORYSPI_BATCH_WRITE:
+                status = _mtb_hal_memoryspi_write_async(obj, step->command, step->address,
+                                                        step->data, &length);
+                pending = true;
+                break;
+
+            case MTB_HAL_MEMORYSPI_BATCH_READ:
+                status = _mtb_hal_memoryspi_read_async(obj, step->command, step->address,
+                                                       step->data, &length);
+                pending = true;
+                break;
+
+            default: /* MTB_HAL_MEMORYSPI_BATCH_POLL */
+                length = 1U;
+                batch->polls++;
+                status = _mtb_hal_memoryspi_read_async(obj, step->command, step->address,
+                                                       &(batch->poll_status), &length);
+                pending = true;
+                break;
+        }
+    }
+
+    if ((CY_RSLT_SUCCESS != status) || (!pending))
+    {
+        _mtb_hal_memoryspi_batch_finish(obj, status);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_batch_run
+//--------------------------------------------------------------------------------------------------
+/* Continues the batch from the thread, the SMIF interrupt or the poll timer. Only one context
+ * issues steps at a time: a step finishing while another context is still issuing leaves it to
+ * that context, which picks it up before letting go. The critical sections only cover the hand
+ * over, not the command FIFO waits or the completion callback. */
+static void _mtb_hal_memoryspi_batch_run(mtb_hal_memoryspi_t* obj)
+{
+    _mtb_hal_memoryspi_batch_t* batch = &(obj->batch);
+    bool owner = false;
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (batch->running)
+    {
+        batch->kick = true;
+    }
+    else
+    {
+        batch->running = true;
+        owner = true;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    while (owner)
+    {
+        _mtb_hal_memoryspi_batch_issue(obj);
+
+        savedIntrStatus = mtb_hal_system_critical_section_enter();
+        owner = batch->kick;
+        batch->kick = false;
+        batch->running = owner;
+        mtb_hal_system_critical_section_exit(savedIntrStatus);
+    }
+}
+
+
+#if defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_batch_poll_timer_cb
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_memoryspi_batch_poll_timer_cb(void* callback_arg, mtb_hal_timer_event_t event)
+{
+    CY_UNUSED_PARAMETER(event);
+    mtb_hal_memoryspi_t* obj = (mtb_hal_memoryspi_t*)callback_arg;
+
+    (void)mtb_hal_timer_stop(obj->batch.poll_timer);
+    if (obj->batch.active)
+    {
+        /* Poll interval elapsed, read the status again */
+        _mtb_hal_memoryspi_batch_run(obj);
+    }
+}
+
+
+#endif /* defined(MTB_HAL_DRIVER_AVAILABLE_TIMER) */
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_batch_step_done
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_memoryspi_batch_step_done(mtb_hal_memoryspi_t* obj)
+{
+    _mtb_hal_memoryspi_batch_t* batch = &(obj->batch);
+    const mtb_hal_memoryspi_batch_step_t* step = &(batch->steps[batch->index]);
+
+    if ((MTB_HAL_MEMORYSPI_BATCH_POLL == step->op) &&
+        ((batch->poll_status & step->poll_mask) != step->poll_value))
+    {
+        if ((0U != step->poll_max) && (batch->polls >= step->poll_max))
+        {
+            _mtb_hal_memoryspi_batch_finish(obj, MTB_HAL_MEMORYSPI_RSLT_ERR_TIMEOUT);
+            return;
+        }
+        /* Not there yet, the same step is issued again once the poll interval elapsed */
+        #if defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+        if (NULL != batch->poll_timer)
+        {
+            if ((CY_RSLT_SUCCESS == mtb_hal_timer_reset(batch->poll_timer, 0U)) &&
+                (CY_RSLT_SUCCESS == mtb_hal_timer_start(batch->poll_timer)))
+            {
+                return;
+            }
+        }
+        #endif /* defined(MTB_HAL_DRIVER_AVAILABLE_TIMER) */
+    }
+    else
+    {
+        batch->index++;
+        batch->polls = 0U;
+    }
+
+    _mtb_hal_memoryspi_batch_run(obj);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_batch_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_memoryspi_batch_start(mtb_hal_memoryspi_t* obj,
+                                        const mtb_hal_memoryspi_batch_step_t* steps,
+                                        uint32_t count)
+{
+    CY_ASSERT(NULL != obj);
+
+    if ((NULL == steps) || (0U == count))
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BAD_ARGUMENT;
+    }
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        if ((NULL == steps[i].command) ||
+            (((MTB_HAL_MEMORYSPI_BATCH_WRITE == steps[i].op) ||
+              (MTB_HAL_MEMORYSPI_BATCH_READ == steps[i].op)) &&
+             ((NULL == steps[i].data) || (0U == steps[i].length))) ||
+            (steps[i].op > MTB_HAL_MEMORYSPI_BATCH_POLL))
+        {
+            return MTB_HAL_MEMORYSPI_RSLT_ERR_BAD_ARGUMENT;
+        }
+    }
+
+    _mtb_hal_memoryspi_batch_t* batch = &(obj->batch);
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    /* Steps never wait for a prefetch, so a batch only starts once the bus is free of it */
+    bool busy = batch->active || obj->cache.prefetch_busy;
+    if (!busy)
+    {
+        batch->active = true;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    if (busy)
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY;
+    }
+
+    batch->steps = steps;
+    batch->count = count;
+    batch->index = 0U;
+    batch->polls = 0U;
+    batch->result = CY_RSLT_SUCCESS;
+    _mtb_hal_memoryspi_batch_run(obj);
+
+    return (obj->batch.active) ? CY_RSLT_SUCCESS : obj->batch.result;
+}
+
+
+#if defined(MTB_HAL_DRIVER_AVAILABLE_TIMER)
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_batch_set_poll_timer
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_memoryspi_batch_set_poll_timer(mtb_hal_memoryspi_t* obj, mtb_hal_timer_t* timer)
+{
+    CY_ASSERT(NULL != obj);
+
+    if (obj->batch.active)
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BUSY;
+    }
+
+    if (NULL != obj->batch.poll_timer)
+    {
+        mtb_hal_timer_enable_event(obj->batch.poll_timer, MTB_HAL_TIMER_EVENT_TERMINAL_COUNT,
+                                   false);
+        mtb_hal_timer_register_callback(obj->batch.poll_timer, NULL, NULL);
+    }
+    obj->batch.poll_timer = timer;
+    if (NULL != timer)
+    {
+        (void)mtb_hal_timer_stop(timer);
+        mtb_hal_timer_register_callback(timer, _mtb_hal_memoryspi_batch_poll_timer_cb, obj);
+        mtb_hal_timer_enable_event(timer, MTB_HAL_TIMER_EVENT_TERMINAL_COUNT, true);
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+#endif /* defined(MTB_HAL_DRIVER_AVAILABLE_TIMER) */
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_is_batch_in_progress
+//--------------------------------------------------------------------------------------------------
+bool mtb_hal_memoryspi_is_batch_in_progress(mtb_hal_memoryspi_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->batch.active;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_get_batch_result
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_memoryspi_get_batch_result(mtb_hal_memoryspi_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->batch.result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_memoryspi_register_callback
 //--------------------------------------------------------------------------------------------------
@@ -777,7 +1276,8 @@ bool mtb_hal_memoryspi_is_async_in_progress(mtb_hal_memoryspi_t* obj)
 
     uint32_t smif_status = Cy_SMIF_GetTransferStatus(obj->base, obj->context);
 
-    return ((CY_SMIF_SEND_BUSY == smif_status) || (CY_SMIF_RX_BUSY == smif_status));
+    return ((CY_SMIF_SEND_BUSY == smif_status) || (CY_SMIF_RX_BUSY == smif_status) ||
+            obj->batch.active);
 }
 
 
@@ -793,6 +1293,224 @@ bool mtb_hal_memoryspi_is_busy(mtb_hal_memoryspi_t* obj)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_cache_enable
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_memoryspi_cache_enable(mtb_hal_memoryspi_t* obj,
+                                         const mtb_hal_memoryspi_cache_config_t* config)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != config);
+
+    if ((NULL == config->read_command) || config->read_command->address.disabled ||
+        (NULL == config->storage) || (NULL == config->tags) || (0U == config->ways) ||
+        (config->line_size < 4U) || (config->line_size > _MTB_HAL_MEMORYSPI_MAX_RX_COUNT) ||
+        (0U != (config->line_size & (config->line_size - 1U))) ||
+        (0U == config->num_sets) || (0U != (config->num_sets & (config->num_sets - 1U))))
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BAD_ARGUMENT;
+    }
+
+    mtb_hal_memoryspi_cache_disable(obj);
+
+    _mtb_hal_memoryspi_cache_t* cache = &(obj->cache);
+    memset(config->tags, 0,
+           MTB_HAL_MEMORYSPI_CACHE_TAG_WORDS(config->num_sets, config->ways) * sizeof(uint32_t));
+    cache->read_command = config->read_command;
+    cache->tags = config->tags;
+    cache->line_size = config->line_size;
+    cache->num_sets = config->num_sets;
+    cache->ways = config->ways;
+    cache->prefetch = config->prefetch;
+    /* No line has been missed yet, make sure address 0 is not seen as sequential */
+    cache->last_miss = 0U - (2U * config->line_size);
+    /* Set last, a non-NULL storage marks the cache as enabled */
+    cache->storage = config->storage;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_cache_disable
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_memoryspi_cache_disable(mtb_hal_memoryspi_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    (void)_mtb_hal_memoryspi_cache_sync(obj);
+    memset(&(obj->cache), 0, sizeof(obj->cache));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_memoryspi_cache_prefetch
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_memoryspi_cache_prefetch(mtb_hal_memoryspi_t* obj, uint32_t line_addr)
+{
+    _mtb_hal_memoryspi_cache_t* cache = &(obj->cache);
+    uint32_t slot;
+    if (cache->prefetch_busy || _mtb_hal_memoryspi_cache_lookup(cache, line_addr, &slot))
+    {
+        return;
+    }
+
+    slot = _mtb_hal_memoryspi_cache_victim(cache, line_addr);
+
+    /* Completion is handled in _mtb_hal_memoryspi_cb_wrapper, so the prefetch is marked as
+     * outstanding before the read is issued. The read goes out without waiting for outstanding
+     * prefetches, which would be this one. A batch owns the bus until it finishes; checking it
+     * in the same critical section keeps a batch from starting behind the prefetch. */
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    bool busy = obj->batch.active;
+    if (!busy)
+    {
+        cache->tags[2U * slot] = 0U;
+        cache->prefetch_slot = slot;
+        cache->prefetch_addr = line_addr;
+        cache->prefetch_busy = true;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    if (busy)
+    {
+        return;
+    }
+
+    size_t length = cache->line_size;
+    if (CY_RSLT_SUCCESS ==
+        _mtb_hal_memoryspi_read_async(obj, cache->read_command, line_addr,
+                                      _mtb_hal_memoryspi_cache_line(cache, slot), &length))
+    {
+        cache->prefetches++;
+    }
+    else
+    {
+        cache->prefetch_busy = false;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_cache_read
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_memoryspi_cache_read(mtb_hal_memoryspi_t* obj, uint32_t address, void* data,
+                                       size_t length)
+{
+    CY_ASSERT(NULL != obj);
+
+    _mtb_hal_memoryspi_cache_t* cache = &(obj->cache);
+    if ((NULL == cache->storage) || ((NULL == data) && (0U != length)))
+    {
+        return MTB_HAL_MEMORYSPI_RSLT_ERR_BAD_ARGUMENT;
+    }
+
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    uint8_t* dst = (uint8_t*)data;
+    bool sequential = false;
+    uint32_t line_addr = 0U;
+
+    while ((length > 0U) && (CY_RSLT_SUCCESS == status))
+    {
+        line_addr = address & ~(cache->line_size - 1U);
+        uint32_t offset = address - line_addr;
+        uint32_t chunk = cache->line_size - offset;
+        if (chunk > length)
+        {
+            chunk = (uint32_t)length;
+        }
+
+        if (cache->prefetch_busy && (line_addr == cache->prefetch_addr))
+        {
+            /* Line is on its way, wait for it instead of reading it again */
+            status = _mtb_hal_memoryspi_cache_sync(obj);
+        }
+
+        uint32_t slot;
+        if (CY_RSLT_SUCCESS != status)
+        {
+            break;
+        }
+        else if (_mtb_hal_memoryspi_cache_lookup(cache, line_addr, &slot))
+        {
+            cache->hits++;
+            if (0U != (cache->tags[2U * slot] & _MTB_HAL_MEMORYSPI_CACHE_PREFETCHED))
+            {
+                /* Stream continues into prefetched data, keep running ahead of it */
+                cache->prefetch_hits++;
+                cache->tags[2U * slot] &= ~_MTB_HAL_MEMORYSPI_CACHE_PREFETCHED;
+                sequential = true;
+            }
+        }
+        else
+        {
+            cache->misses++;
+            slot = _mtb_hal_memoryspi_cache_victim(cache, line_addr);
+            size_t fill = cache->line_size;
+            status = mtb_hal_memoryspi_read(obj, cache->read_command, line_addr,
+                                            _mtb_hal_memoryspi_cache_line(cache, slot), &fill);
+            if (CY_RSLT_SUCCESS != status)
+            {
+                cache->tags[2U * slot] = 0U;
+                break;
+            }
+            cache->tags[2U * slot] = line_addr | _MTB_HAL_MEMORYSPI_CACHE_VALID;
+            sequential = (line_addr == (cache->last_miss + cache->line_size));
+            cache->last_miss = line_addr;
+        }
+
+        cache->tags[(2U * slot) + 1U] = ++cache->use_stamp;
+        memcpy(dst, &(_mtb_hal_memoryspi_cache_line(cache, slot)[offset]), chunk);
+        dst += chunk;
+        address += chunk;
+        length -= chunk;
+    }
+
+    if ((CY_RSLT_SUCCESS == status) && cache->prefetch && sequential)
+    {
+        _mtb_hal_memoryspi_cache_prefetch(obj, line_addr + cache->line_size);
+    }
+
+    return status;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_cache_invalidate
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_memoryspi_cache_invalidate(mtb_hal_memoryspi_t* obj, uint32_t address, size_t length)
+{
+    CY_ASSERT(NULL != obj);
+    _mtb_hal_memoryspi_cache_invalidate_range(obj, address, length);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_memoryspi_cache_get_stats
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_memoryspi_cache_get_stats(mtb_hal_memoryspi_t* obj,
+                                       mtb_hal_memoryspi_cache_stats_t* stats, bool reset)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != stats);
+
+    _mtb_hal_memoryspi_cache_t* cache = &(obj->cache);
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    stats->hits = cache->hits;
+    stats->misses = cache->misses;
+    stats->prefetches = cache->prefetches;
+    stats->prefetch_hits = cache->prefetch_hits;
+    stats->invalidations = cache->invalidations;
+    if (reset)
+    {
+        cache->hits = 0U;
+        cache->misses = 0U;
+        cache->prefetches = 0U;
+        cache->prefetch_hits = 0U;
+        cache->invalidations = 0U;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
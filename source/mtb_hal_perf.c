@@ -0,0 +1,268 @@
+/***************************************************************************//**
+* \file mtb_hal_perf.c
+*
+* \brief
+* Provides the per-instance counter helpers and the event trace ring used to
+* instrument the HAL drivers.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024-2025 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+#include "mtb_hal_perf.h"
+#include "mtb_hal_system.h"
+
+#if defined(MTB_HAL_PERF_ENABLE)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+/** Trace ring state. head is a free-running count of reserved slots, tail of read slots. */
+static mtb_hal_perf_trace_entry_t* volatile _mtb_hal_perf_trace_storage = NULL;
+static volatile uint32_t _mtb_hal_perf_trace_mask = 0U;
+static volatile uint32_t _mtb_hal_perf_trace_head = 0U;
+static uint32_t _mtb_hal_perf_trace_tail = 0U;
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_perf_trace_reserve
+//--------------------------------------------------------------------------------------------------
+/* Reserves the next slot without disabling interrupts. A writer preempted between the load and
+   the store loses its reservation and retries. */
+static inline uint32_t _mtb_hal_perf_trace_reserve(void)
+{
+    uint32_t index;
+    do
+    {
+        index = __LDREXW(&_mtb_hal_perf_trace_head);
+    } while (0U != __STREXW(index + 1U, &_mtb_hal_perf_trace_head));
+    return index;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_perf_enable_cycles
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_perf_enable_cycles(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_perf_read_counters
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_perf_read_counters(mtb_hal_perf_counters_t* counters,
+                                mtb_hal_perf_counters_t* snapshot, bool reset)
+{
+    CY_ASSERT(NULL != counters);
+    CY_ASSERT(NULL != snapshot);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    *snapshot = *counters;
+    if (reset)
+    {
+        (void)memset(counters, 0, sizeof(*counters));
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_perf_trace_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_perf_trace_start(mtb_hal_perf_trace_entry_t* storage, uint32_t size)
+{
+    if ((NULL == storage) || (0U == size) || (0U != (size & (size - 1U))))
+    {
+        return MTB_HAL_PERF_RSLT_ERR_BAD_ARGUMENT;
+    }
+
+    mtb_hal_perf_enable_cycles();
+    (void)memset(storage, 0, size * sizeof(mtb_hal_perf_trace_entry_t));
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    _mtb_hal_perf_trace_storage = storage;
+    _mtb_hal_perf_trace_mask = size - 1U;
+    _mtb_hal_perf_trace_head = 0U;
+    _mtb_hal_perf_trace_tail = 0U;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_perf_trace_stop
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_perf_trace_stop(void)
+{
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    _mtb_hal_perf_trace_storage = NULL;
+    _mtb_hal_perf_trace_mask = 0U;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_perf_trace_read
+//--------------------------------------------------------------------------------------------------
+uint32_t mtb_hal_perf_trace_read(mtb_hal_perf_trace_entry_t* entries, uint32_t count,
+                                 uint32_t* lost)
+{
+    mtb_hal_perf_trace_entry_t* storage = _mtb_hal_perf_trace_storage;
+    uint32_t mask = _mtb_hal_perf_trace_mask;
+    uint32_t copied = 0U;
+    uint32_t skipped = 0U;
+
+    if ((NULL != storage) && (NULL != entries))
+    {
+        uint32_t head = _mtb_hal_perf_trace_head;
+
+        /* Entries older than one lap have been overwritten */
+        if ((head - _mtb_hal_perf_trace_tail) > (mask + 1U))
+        {
+            skipped = head - _mtb_hal_perf_trace_tail - (mask + 1U);
+            _mtb_hal_perf_trace_tail = head - (mask + 1U);
+        }
+
+        while ((copied < count) && (_mtb_hal_perf_trace_tail != head))
+        {
+            mtb_hal_perf_trace_entry_t* slot = &storage[_mtb_hal_perf_trace_tail & mask];
+            uint32_t expected = _mtb_hal_perf_trace_tail + 1U;
+
+            if (slot->sequence != expected)
+            {
+                /* Reserved but not yet written; stop here and pick it up on the next read */
+                if ((int32_t)(slot->sequence - expected) < 0)
+                {
+                    break;
+                }
+                /* Already overwritten by a later lap */
+                ++skipped;
+            }
+            else
+            {
+                entries[copied] = *slot;
+                __DMB();
+                /* Discard the copy if a writer replaced the slot while it was being read */
+                if (slot->sequence == expected)
+                {
+                    ++copied;
+                }
+                else
+                {
+                    ++skipped;
+                }
+            }
+            ++_mtb_hal_perf_trace_tail;
+        }
+    }
+
+    if (NULL != lost)
+    {
+        *lost = skipped;
+    }
+    return copied;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_perf_add
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_perf_add(uint32_t* counter, uint32_t value)
+{
+    /* Called from thread context too, where the read-modify-write could lose an update made by
+       the interrupt handler of the same driver */
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    *counter += value;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_perf_trace_record
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_perf_trace_record(uint8_t module, mtb_hal_perf_event_t event, const void* instance,
+                                uint32_t arg)
+{
+    mtb_hal_perf_trace_entry_t* storage = _mtb_hal_perf_trace_storage;
+    if (NULL != storage)
+    {
+        uint32_t index = _mtb_hal_perf_trace_reserve();
+        mtb_hal_perf_trace_entry_t* slot = &storage[index & _mtb_hal_perf_trace_mask];
+
+        /* Invalidate the slot first so a concurrent reader does not accept a half-written entry */
+        slot->sequence = 0U;
+        __DMB();
+        slot->cycles = mtb_hal_perf_get_cycles();
+        slot->instance = instance;
+        slot->arg = arg;
+        slot->module = module;
+        slot->event = (uint8_t)event;
+        __DMB();
+        slot->sequence = index + 1U;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_perf_isr_exit
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_perf_isr_exit(uint8_t module, const void* instance,
+                            mtb_hal_perf_counters_t* counters, uint32_t start)
+{
+    uint32_t cycles = mtb_hal_perf_get_cycles() - start;
+
+    ++counters->isr_count;
+    counters->isr_cycles_total += cycles;
+    if (cycles > counters->isr_cycles_max)
+    {
+        counters->isr_cycles_max = cycles;
+    }
+    _mtb_hal_perf_trace_record(module, MTB_HAL_PERF_EVENT_ISR_EXIT, instance, cycles);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_perf_complete
+//--------------------------------------------------------------------------------------------------
+void _mtb_hal_perf_complete(uint8_t module, const void* instance,
+                            mtb_hal_perf_counters_t* counters, uint32_t start, uint32_t bytes)
+{
+    uint32_t cycles = mtb_hal_perf_get_cycles() - start;
+
+    counters->bytes += bytes;
+    counters->latency_cycles_last = cycles;
+    if (cycles > counters->latency_cycles_max)
+    {
+        counters->latency_cycles_max = cycles;
+    }
+    _mtb_hal_perf_trace_record(module, MTB_HAL_PERF_EVENT_XFER_DONE, instance, cycles);
+}
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // defined(MTB_HAL_PERF_ENABLE)
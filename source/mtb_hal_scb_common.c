@@ -0,0 +1,218 @@
+/***************************************************************************//**
+* \file mtb_hal_scb_common.c
+*
+* \brief
+* Provides the per-instance dispatch of PDL SCB callbacks to the HAL object that
+* owns each SCB block.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024-2025 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mtb_hal_scb_common.h"
+#include "mtb_hal_system.h"
+
+#if defined(CY_IP_MXSCB) || defined(CY_IP_MXS22SCB)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+/* Object and handlers bound to each SCB block. Written only when a driver registers its
+   callbacks; the interrupt path only reads the entry of its own block. */
+typedef struct
+{
+    void*                           obj;
+    _mtb_hal_scb_event_handler_t    event;
+    _mtb_hal_scb_addr_handler_t     addr;
+} _mtb_hal_scb_binding_t;
+
+static _mtb_hal_scb_binding_t _mtb_hal_scb_bindings[_MTB_HAL_SCB_INSTANCES];
+
+/* One pair of PDL callbacks per SCB block, each knowing its own block index */
+#define _MTB_HAL_SCB_DISPATCH(n)                                                        \
+    static void _mtb_hal_scb_event_##n(uint32_t event)                                  \
+    {                                                                                   \
+        _mtb_hal_scb_bindings[n].event(_mtb_hal_scb_bindings[n].obj, event);            \
+    }                                                                                   \
+    static cy_en_scb_i2c_command_t _mtb_hal_scb_addr_##n(uint32_t event)                \
+    {                                                                                   \
+        return _mtb_hal_scb_bindings[n].addr(_mtb_hal_scb_bindings[n].obj, event);      \
+    }
+
+_MTB_HAL_SCB_DISPATCH(0)
+#if (_MTB_HAL_SCB_INSTANCES > 1)
+_MTB_HAL_SCB_DISPATCH(1)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 2)
+_MTB_HAL_SCB_DISPATCH(2)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 3)
+_MTB_HAL_SCB_DISPATCH(3)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 4)
+_MTB_HAL_SCB_DISPATCH(4)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 5)
+_MTB_HAL_SCB_DISPATCH(5)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 6)
+_MTB_HAL_SCB_DISPATCH(6)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 7)
+_MTB_HAL_SCB_DISPATCH(7)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 8)
+_MTB_HAL_SCB_DISPATCH(8)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 9)
+_MTB_HAL_SCB_DISPATCH(9)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 10)
+_MTB_HAL_SCB_DISPATCH(10)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 11)
+_MTB_HAL_SCB_DISPATCH(11)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 12)
+_MTB_HAL_SCB_DISPATCH(12)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 13)
+_MTB_HAL_SCB_DISPATCH(13)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 14)
+_MTB_HAL_SCB_DISPATCH(14)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 15)
+_MTB_HAL_SCB_DISPATCH(15)
+#endif
+#if (_MTB_HAL_SCB_INSTANCES > 16)
+#error "Unsupported number of SCB instances"
+#endif
+
+#define _MTB_HAL_SCB_DISPATCH_ENTRY(n)      { _mtb_hal_scb_event_##n, _mtb_hal_scb_addr_##n }
+
+static const struct
+{
+    _mtb_hal_scb_pdl_event_cb_t     event;
+    _mtb_hal_scb_pdl_addr_cb_t      addr;
+} _mtb_hal_scb_dispatch[_MTB_HAL_SCB_INSTANCES] =
+{
+    _MTB_HAL_SCB_DISPATCH_ENTRY(0),
+    #if (_MTB_HAL_SCB_INSTANCES > 1)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(1),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 2)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(2),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 3)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(3),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 4)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(4),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 5)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(5),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 6)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(6),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 7)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(7),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 8)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(8),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 9)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(9),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 10)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(10),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 11)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(11),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 12)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(12),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 13)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(13),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 14)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(14),
+    #endif
+    #if (_MTB_HAL_SCB_INSTANCES > 15)
+    _MTB_HAL_SCB_DISPATCH_ENTRY(15),
+    #endif
+};
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_scb_get_block_index
+//--------------------------------------------------------------------------------------------------
+uint32_t _mtb_hal_scb_get_block_index(const CySCB_Type* base)
+{
+    uint32_t index = 0u;
+    #if (_MTB_HAL_SCB_INSTANCES > 1) && defined(SCB1)
+    /* SCB blocks are laid out at a fixed stride from SCB0 */
+    index = ((uint32_t)base - (uint32_t)SCB0) / ((uint32_t)SCB1 - (uint32_t)SCB0);
+    #else
+    CY_UNUSED_PARAMETER(base);
+    #endif
+    CY_ASSERT(index < _MTB_HAL_SCB_INSTANCES);
+    return index;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_scb_bind_event
+//--------------------------------------------------------------------------------------------------
+_mtb_hal_scb_pdl_event_cb_t _mtb_hal_scb_bind_event(const CySCB_Type* base, void* obj,
+                                                    _mtb_hal_scb_event_handler_t handler)
+{
+    uint32_t index = _mtb_hal_scb_get_block_index(base);
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    _mtb_hal_scb_bindings[index].obj = obj;
+    _mtb_hal_scb_bindings[index].event = handler;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return _mtb_hal_scb_dispatch[index].event;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_scb_bind_addr
+//--------------------------------------------------------------------------------------------------
+_mtb_hal_scb_pdl_addr_cb_t _mtb_hal_scb_bind_addr(const CySCB_Type* base, void* obj,
+                                                  _mtb_hal_scb_addr_handler_t handler)
+{
+    uint32_t index = _mtb_hal_scb_get_block_index(base);
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    _mtb_hal_scb_bindings[index].obj = obj;
+    _mtb_hal_scb_bindings[index].addr = handler;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return _mtb_hal_scb_dispatch[index].addr;
+}
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* defined(CY_IP_MXSCB) || defined(CY_IP_MXS22SCB) */
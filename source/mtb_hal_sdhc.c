@@ -77,6 +77,12 @@ extern "C"
                                                                          for one block */
 #define _MTB_HAL_SDHC_TRANSFER_TIMEOUT                    (0xCUL)     /* The transfer timeout */
 #define _MTB_HAL_SDHC_EMMC_TRIM_DELAY_MS                  (100U)      /* The EMMC TRIM timeout */
+#define _MTB_HAL_SDHC_ADMA2_MAX_SEGMENT_BLOCKS            (127U)      /* Blocks that fit the 16-bit
+                                                                         ADMA2 length field */
+#define _MTB_HAL_SDHC_CMD_READ_SINGLE_BLOCK               (17U)
+#define _MTB_HAL_SDHC_CMD_READ_MULTIPLE_BLOCK             (18U)
+#define _MTB_HAL_SDHC_CMD_WRITE_BLOCK                     (24U)
+#define _MTB_HAL_SDHC_CMD_WRITE_MULTIPLE_BLOCK            (25U)
 #define _MTB_HAL_SDHC_ALL_ERR_INTERRUPTS                  \
     (MTB_HAL_SDHC_CMD_TOUT_ERR | MTB_HAL_SDHC_CMD_CRC_ERR |\
     MTB_HAL_SDHC_CMD_END_BIT_ERR | MTB_HAL_SDHC_CMD_IDX_ERR |\
@@ -266,6 +272,18 @@ __STATIC_INLINE bool _mtb_hal_sdxx_is_smfr_ready_for_get(_mtb_hal_sdxx_t* sdxx)
 
 #endif /* CY_RTOS_AWARE or COMPONENT_RTOS_AWARE defined */
 
+/* Software reset of SDHC block data and command circuits */
+static void _mtb_hal_sdxx_reset(_mtb_hal_sdxx_t* sdxx)
+{
+    CY_ASSERT(NULL != sdxx);
+    CY_ASSERT(NULL != sdxx->base);
+
+    sdxx->data_transfer_status = _MTB_HAL_SDXX_NOT_RUNNING;
+    Cy_SD_Host_SoftwareReset(sdxx->base, CY_SD_HOST_RESET_DATALINE);
+    Cy_SD_Host_SoftwareReset(sdxx->base, CY_SD_HOST_RESET_CMD_LINE);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_sdxx_prepare_for_transfer
 //--------------------------------------------------------------------------------------------------
@@ -697,11 +715,264 @@ static cy_rslt_t _mtb_hal_sdxx_waitfor_transfer_complete(_mtb_hal_sdxx_t* sdxx)
     return result;
 }
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_sdhc_stream_blocks
+//--------------------------------------------------------------------------------------------------
+static uint32_t _mtb_hal_sdhc_stream_blocks(const mtb_hal_sdhc_stream_request_t* request)
+{
+    uint32_t blocks = 0UL;
+    for (uint8_t i = 0U; i < request->num_segments; i++)
+    {
+        blocks += request->segments[i].num_blocks;
+    }
+    return blocks;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_sdhc_stream_build_table
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_sdhc_stream_build_table(uint32_t* tbl,
+                                             const mtb_hal_sdhc_stream_request_t* request)
+{
+    /* One TRAN descriptor per segment, END set on the last one */
+    for (uint8_t i = 0U; i < request->num_segments; i++)
+    {
+        const mtb_hal_sdhc_stream_segment_t* segment = &(request->segments[i]);
+        uint32_t length = segment->num_blocks * _MTB_HAL_SDHC_BLOCK_SIZE;
+        uint32_t is_end = (i == (request->num_segments - 1U)) ? 1UL : 0UL;
+
+        tbl[2U * i] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | /* Attr Valid */
+                      (is_end << CY_SD_HOST_ADMA_ATTR_END_POS) | /* Attr End */
+                      (0UL << CY_SD_HOST_ADMA_ATTR_INT_POS) | /* Attr Int */
+                      (CY_SD_HOST_ADMA_TRAN << CY_SD_HOST_ADMA_ACT_POS) |
+                      (length << CY_SD_HOST_ADMA_LEN_POS); /* Len */
+
+        /* SDHC needs to be able to access data that is in DTCM when using CM55 */
+        #if defined(CORE_NAME_CM55_0)
+        tbl[(2U * i) + 1U] = (uint32_t)cy_DTCMRemapAddr(segment->data);
+        #else
+        tbl[(2U * i) + 1U] = (uint32_t)segment->data;
+        #endif
+
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        if (request->write)
+        {
+            SCB_CleanDCache_by_Addr((void*)segment->data, (int32_t)length);
+        }
+        #endif
+    }
+
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void*)tbl, (int32_t)(2U * request->num_segments * sizeof(uint32_t)));
+    #endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_sdhc_stream_issue
+//--------------------------------------------------------------------------------------------------
+static cy_rslt_t _mtb_hal_sdhc_stream_issue(mtb_hal_sdhc_t* obj,
+                                            const mtb_hal_sdhc_stream_request_t* request,
+                                            uint32_t* tbl)
+{
+    _mtb_hal_sdxx_t* sdxx = &(obj->sdxx);
+    uint32_t blocks = _mtb_hal_sdhc_stream_blocks(request);
+    bool multi_block = (1UL != blocks);
+
+    uint32_t argument = request->address;
+    if (CY_SD_HOST_SDSC == sdxx->context->cardCapacity)
+    {
+        /* Standard capacity cards are byte addressed */
+        argument *= _MTB_HAL_SDHC_BLOCK_SIZE;
+    }
+
+    cy_stc_sd_host_data_config_t dataConfig =
+    {
+        .blockSize           = _MTB_HAL_SDHC_BLOCK_SIZE,
+        .numberOfBlock       = blocks,
+        .enableDma           = true,
+        .autoCommand         = multi_block ? CY_SD_HOST_AUTO_CMD_AUTO : CY_SD_HOST_AUTO_CMD_NONE,
+        .read                = !request->write,
+        #if defined(CORE_NAME_CM55_0)
+        .data                = (uint32_t*)cy_DTCMRemapAddr(tbl),
+        #else
+        .data                = tbl, /* The address of the ADMA descriptor table. */
+        #endif
+        .dataTimeout         = obj->data_timeout_tout,
+        .enableIntAtBlockGap = false,
+        .enReliableWrite     = false
+    };
+
+    cy_stc_sd_host_cmd_config_t cmd =
+    {
+        .commandIndex                 = request->write
+            ? (multi_block ? _MTB_HAL_SDHC_CMD_WRITE_MULTIPLE_BLOCK : _MTB_HAL_SDHC_CMD_WRITE_BLOCK)
+            : (multi_block ? _MTB_HAL_SDHC_CMD_READ_MULTIPLE_BLOCK :
+               _MTB_HAL_SDHC_CMD_READ_SINGLE_BLOCK),
+        .commandArgument              = argument,
+        .enableCrcCheck               = true,
+        .enableAutoResponseErrorCheck = false,
+        .respType                     = CY_SD_HOST_RESPONSE_LEN_48,
+        .enableIdxCheck               = true,
+        .dataPresent                  = true,
+        .cmdType                      = CY_SD_HOST_CMD_NORMAL
+    };
+
+    /* First clear out the transfer and command complete statuses */
+    Cy_SD_Host_ClearNormalInterruptStatus(sdxx->base,
+                                          (CY_SD_HOST_XFER_COMPLETE | CY_SD_HOST_CMD_COMPLETE));
+
+    cy_rslt_t result = _mtb_hal_sdxx_prepare_for_transfer(sdxx);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        /* A failing transfer raises only error interrupts and never completes, so let those reach
+         * _mtb_hal_sdhc_irq_handler too while streaming */
+        Cy_SD_Host_ClearErrorInterruptStatus(sdxx->base, _MTB_HAL_SDHC_ALL_ERR_INTERRUPTS);
+        Cy_SD_Host_SetErrorInterruptMask(sdxx->base, _MTB_HAL_SDHC_ALL_ERR_INTERRUPTS);
+        result = (cy_rslt_t)Cy_SD_Host_InitDataTransfer(sdxx->base, &dataConfig);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        /* Completion is picked up by _mtb_hal_sdhc_irq_handler, the command complete stage is not
+         * waited for */
+        sdxx->data_transfer_status = _MTB_HAL_SDXX_WAIT_XFER_COMPLETE;
+        if (NULL != obj->stream.get_ticks)
+        {
+            obj->stream.issue_ticks = obj->stream.get_ticks();
+        }
+        result = (cy_rslt_t)Cy_SD_Host_SendCommand(sdxx->base, &cmd);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        sdxx->data_transfer_status = _MTB_HAL_SDXX_NOT_RUNNING;
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_sdhc_stream_complete
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_sdhc_stream_complete(mtb_hal_sdhc_t* obj, cy_rslt_t result)
+{
+    _mtb_hal_sdhc_stream_t* stream = &(obj->stream);
+    mtb_hal_sdhc_stream_request_t* request = stream->queue[stream->head];
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        stream->bytes += (uint64_t)_mtb_hal_sdhc_stream_blocks(request) * _MTB_HAL_SDHC_BLOCK_SIZE;
+        stream->commands++;
+        if (NULL != stream->get_ticks)
+        {
+            uint32_t latency = stream->get_ticks() - stream->issue_ticks;
+            stream->latency_last = latency;
+            stream->latency_total += latency;
+            if (latency > stream->latency_max)
+            {
+                stream->latency_max = latency;
+            }
+        }
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        if (!request->write)
+        {
+            for (uint8_t i = 0U; i < request->num_segments; i++)
+            {
+                SCB_InvalidateDCache_by_Addr((void*)request->segments[i].data,
+                                             (int32_t)(request->segments[i].num_blocks *
+                                                       _MTB_HAL_SDHC_BLOCK_SIZE));
+            }
+        }
+        #endif
+    }
+    else
+    {
+        stream->errors++;
+    }
+
+    request->result = result;
+    request->complete = true;
+
+    stream->head = (uint8_t)((stream->head + 1U) % stream->queue_size);
+    stream->count--;
+    /* The table built for the next request becomes the active one */
+    stream->active_tbl ^= 1U;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_sdhc_stream_issue_next
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_sdhc_stream_issue_next(mtb_hal_sdhc_t* obj)
+{
+    _mtb_hal_sdhc_stream_t* stream = &(obj->stream);
+
+    while (stream->count > 0U)
+    {
+        uint32_t* tbl = stream->adma_tbl[stream->active_tbl];
+        if (!stream->next_ready)
+        {
+            _mtb_hal_sdhc_stream_build_table(tbl, stream->queue[stream->head]);
+        }
+        stream->next_ready = false;
+
+        if (CY_RSLT_SUCCESS == _mtb_hal_sdhc_stream_issue(obj, stream->queue[stream->head], tbl))
+        {
+            /* Prepare the following request while this one is on the bus */
+            if (stream->count > 1U)
+            {
+                uint8_t next = (uint8_t)((stream->head + 1U) % stream->queue_size);
+                _mtb_hal_sdhc_stream_build_table(stream->adma_tbl[stream->active_tbl ^ 1U],
+                                                 stream->queue[next]);
+                stream->next_ready = true;
+            }
+            break;
+        }
+
+        _mtb_hal_sdhc_stream_complete(obj, MTB_HAL_SDHC_RSLT_ERR_STREAM_XFER);
+    }
+
+    if (0U == stream->count)
+    {
+        /* Nothing left on the bus, hand error reporting back to the polling functions */
+        Cy_SD_Host_SetErrorInterruptMask(obj->sdxx.base, 0U);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_sdhc_stream_xfer_done
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_sdhc_stream_xfer_done(mtb_hal_sdhc_t* obj)
+{
+    _mtb_hal_sdxx_t* sdxx = &(obj->sdxx);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    /* Ends either with the transfer complete event or, for a data timeout, CRC or ADMA error,
+     * with only the error interrupt */
+    Cy_SD_Host_SetNormalInterruptMask(sdxx->base, Cy_SD_Host_GetNormalInterruptMask(sdxx->base) &
+                                      (uint32_t) ~CY_SD_HOST_XFER_COMPLETE);
+    if (0U != Cy_SD_Host_GetErrorInterruptStatus(sdxx->base))
+    {
+        result = MTB_HAL_SDHC_RSLT_ERR_STREAM_XFER;
+        /* The failed transfer may have left the data and command lines busy */
+        _mtb_hal_sdxx_reset(sdxx);
+        Cy_SD_Host_ClearErrorInterruptStatus(sdxx->base, _MTB_HAL_SDHC_ALL_ERR_INTERRUPTS);
+        Cy_SD_Host_ClearNormalInterruptStatus(sdxx->base, CY_SD_HOST_XFER_COMPLETE);
+    }
+    sdxx->data_transfer_status = _MTB_HAL_SDXX_NOT_RUNNING;
+
+    _mtb_hal_sdhc_stream_complete(obj, result);
+    _mtb_hal_sdhc_stream_issue_next(obj);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_sdhc_irq_handler
 //--------------------------------------------------------------------------------------------------
 static void _mtb_hal_sdhc_irq_handler(_mtb_hal_sdxx_t* sdxx)
 {
+    mtb_hal_sdhc_t* obj = (mtb_hal_sdhc_t*)sdxx->obj;
     uint32_t interruptStatus = Cy_SD_Host_GetNormalInterruptStatus(sdxx->base);
     uint32_t userInterruptStatus = interruptStatus & sdxx->irq_cause;
 
@@ -747,6 +1018,20 @@ static void _mtb_hal_sdhc_irq_handler(_mtb_hal_sdxx_t* sdxx)
         Cy_SD_Host_SetNormalInterruptMask(sdxx->base,
                                           Cy_SD_Host_GetNormalInterruptMask(
                                               sdxx->base) & (uint32_t) ~CY_SD_HOST_XFER_COMPLETE);
+
+        /* In streaming mode retire the finished request and issue the next queued one, which
+         * re-enables the transfer complete interrupt mask */
+        if (0U != obj->stream.count)
+        {
+            _mtb_hal_sdhc_stream_xfer_done(obj);
+        }
+    }
+    else if ((0U != obj->stream.count) &&
+             (0U != (Cy_SD_Host_GetErrorInterruptStatus(sdxx->base) &
+                     Cy_SD_Host_GetErrorInterruptMask(sdxx->base))))
+    {
+        /* A streamed request failed without completing, retire it with the error */
+        _mtb_hal_sdhc_stream_xfer_done(obj);
     }
 
     /* Cannot clear cmd complete interrupt, as it is being polling-waited by many SD Host
@@ -856,18 +1141,6 @@ static void _mtb_hal_sdio_irq_handler(mtb_hal_sdio_t* obj)
 }
 
 
-/* Software reset of SDHC block data and command circuits */
-static void _mtb_hal_sdxx_reset(_mtb_hal_sdxx_t* sdxx)
-{
-    CY_ASSERT(NULL != sdxx);
-    CY_ASSERT(NULL != sdxx->base);
-
-    sdxx->data_transfer_status = _MTB_HAL_SDXX_NOT_RUNNING;
-    Cy_SD_Host_SoftwareReset(sdxx->base, CY_SD_HOST_RESET_DATALINE);
-    Cy_SD_Host_SoftwareReset(sdxx->base, CY_SD_HOST_RESET_CMD_LINE);
-}
-
-
 // Internal function is needed for switching from 1.8V IO Voltage Signaling to 3.3V Signaling, due
 // to a necessary power cycle of the card
 static cy_rslt_t _mtb_hal_sdhc_init_card_common(mtb_hal_sdhc_t* obj)
@@ -1150,6 +1423,173 @@ cy_rslt_t mtb_hal_sdhc_write_async(mtb_hal_sdhc_t* obj, uint32_t address, const
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_sdhc_stream_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_sdhc_stream_start(mtb_hal_sdhc_t* obj, const mtb_hal_sdhc_stream_config_t* config)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != config);
+
+    if ((NULL == config->queue) || (0U == config->queue_size) ||
+        (NULL == config->adma_tables) || (0U == config->max_segments))
+    {
+        return MTB_HAL_SDHC_RSLT_ERR_WRONG_PARAM;
+    }
+    if ((0U != obj->stream.count) || (_MTB_HAL_SDXX_NOT_RUNNING != obj->sdxx.data_transfer_status))
+    {
+        return MTB_HAL_SDHC_RSLT_ERR_BUSY;
+    }
+
+    _mtb_hal_sdhc_stream_t* stream = &(obj->stream);
+    memset(stream, 0, sizeof(_mtb_hal_sdhc_stream_t));
+    stream->queue = config->queue;
+    stream->queue_size = config->queue_size;
+    stream->max_segments = config->max_segments;
+    stream->adma_tbl[0] = config->adma_tables;
+    stream->adma_tbl[1] = &(config->adma_tables[2U * config->max_segments]);
+    stream->get_ticks = config->get_ticks;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_sdhc_stream_submit
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_sdhc_stream_submit(mtb_hal_sdhc_t* obj, mtb_hal_sdhc_stream_request_t* request)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != request);
+
+    _mtb_hal_sdhc_stream_t* stream = &(obj->stream);
+    if ((NULL == stream->queue) || (NULL == request->segments) ||
+        (0U == request->num_segments) || (request->num_segments > stream->max_segments))
+    {
+        return MTB_HAL_SDHC_RSLT_ERR_WRONG_PARAM;
+    }
+    for (uint8_t i = 0U; i < request->num_segments; i++)
+    {
+        if ((NULL == request->segments[i].data) || (0UL == request->segments[i].num_blocks) ||
+            (request->segments[i].num_blocks > _MTB_HAL_SDHC_ADMA2_MAX_SEGMENT_BLOCKS))
+        {
+            return MTB_HAL_SDHC_RSLT_ERR_WRONG_PARAM;
+        }
+    }
+
+    request->complete = false;
+    request->result = CY_RSLT_SUCCESS;
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (stream->count == stream->queue_size)
+    {
+        result = MTB_HAL_SDHC_RSLT_ERR_STREAM_QUEUE_FULL;
+    }
+    else
+    {
+        stream->queue[(stream->head + stream->count) % stream->queue_size] = request;
+        stream->count++;
+        if (stream->count > stream->depth_max)
+        {
+            stream->depth_max = stream->count;
+        }
+
+        if (1U == stream->count)
+        {
+            /* Bus is idle */
+            _mtb_hal_sdhc_stream_issue_next(obj);
+        }
+        else if ((2U == stream->count) && !stream->next_ready)
+        {
+            /* Build the table now so the transfer complete interrupt only issues the command */
+            _mtb_hal_sdhc_stream_build_table(stream->adma_tbl[stream->active_tbl ^ 1U], request);
+            stream->next_ready = true;
+        }
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    if ((CY_RSLT_SUCCESS == result) && request->complete)
+    {
+        /* Command could not be issued */
+        result = request->result;
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_sdhc_stream_stop
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_sdhc_stream_stop(mtb_hal_sdhc_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    _mtb_hal_sdxx_t* sdxx = &(obj->sdxx);
+    _mtb_hal_sdhc_stream_t* stream = &(obj->stream);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    /* Keep the interrupt handler from issuing anything else */
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    Cy_SD_Host_SetNormalInterruptMask(sdxx->base, Cy_SD_Host_GetNormalInterruptMask(sdxx->base) &
+                                      (uint32_t) ~CY_SD_HOST_XFER_COMPLETE);
+    Cy_SD_Host_SetErrorInterruptMask(sdxx->base, 0U);
+    bool running = (0U != stream->count);
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    if (running)
+    {
+        if (_MTB_HAL_SDXX_NOT_RUNNING != sdxx->data_transfer_status)
+        {
+            result = (cy_rslt_t)Cy_SD_Host_AbortTransfer(sdxx->base, sdxx->context);
+            sdxx->data_transfer_status = _MTB_HAL_SDXX_NOT_RUNNING;
+        }
+        while (0U != stream->count)
+        {
+            _mtb_hal_sdhc_stream_complete(obj, MTB_HAL_SDHC_RSLT_ERR_STREAM_XFER);
+        }
+    }
+
+    stream->queue = NULL;
+    stream->next_ready = false;
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_sdhc_stream_get_stats
+//--------------------------------------------------------------------------------------------------
+void mtb_hal_sdhc_stream_get_stats(mtb_hal_sdhc_t* obj, mtb_hal_sdhc_stream_stats_t* stats,
+                                   bool reset)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != stats);
+
+    _mtb_hal_sdhc_stream_t* stream = &(obj->stream);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    stats->bytes_transferred = stream->bytes;
+    stats->commands_completed = stream->commands;
+    stats->errors = stream->errors;
+    stats->queue_depth = stream->count;
+    stats->queue_depth_max = stream->depth_max;
+    stats->latency_last = stream->latency_last;
+    stats->latency_max = stream->latency_max;
+    stats->latency_total = stream->latency_total;
+    if (reset)
+    {
+        stream->bytes = 0U;
+        stream->commands = 0UL;
+        stream->errors = 0UL;
+        stream->depth_max = stream->count;
+        stream->latency_last = 0UL;
+        stream->latency_max = 0UL;
+        stream->latency_total = 0U;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_sdhc_is_card_inserted
 //--------------------------------------------------------------------------------------------------
@@ -1938,6 +2378,8 @@ static cy_rslt_t _mtb_hal_sdio_host_transfer_async(mtb_hal_sdio_t* obj,
     }
     #endif
 
+    _MTB_HAL_PERF_TRACE(MTB_HAL_RSLT_MODULE_SDIO, MTB_HAL_PERF_EVENT_XFER_START, obj, length);
+    _MTB_HAL_PERF_BUSY_BEGIN();
     do
     {
         /* Add SDIO Error Handling
@@ -1958,6 +2400,13 @@ static cy_rslt_t _mtb_hal_sdio_host_transfer_async(mtb_hal_sdio_t* obj,
         if ((Cy_SD_Host_GetNormalInterruptStatus(sdxx->base) & CY_SD_HOST_ERR_INTERRUPT) ||
             (retry < _MTB_HAL_SDIO_TRANSFER_TRIES))
         {
+            #if defined(MTB_HAL_PERF_ENABLE)
+            if (retry < _MTB_HAL_SDIO_TRANSFER_TRIES)
+            {
+                ++obj->perf.retries;
+                _MTB_HAL_PERF_TRACE(MTB_HAL_RSLT_MODULE_SDIO, MTB_HAL_PERF_EVENT_RETRY, obj, retry);
+            }
+            #endif // defined(MTB_HAL_PERF_ENABLE)
             /* Reset the block if there was an error. Note a full reset usually
              * requires more time, but this short version is working quite well and
              * successfully clears out the error state.
@@ -2039,11 +2488,19 @@ static cy_rslt_t _mtb_hal_sdio_host_transfer_async(mtb_hal_sdio_t* obj,
             result = (cy_rslt_t)_mtb_hal_sdxx_pollcmdcomplete(sdxx, NULL);
         }
     } while ((CY_RSLT_SUCCESS != result) && (--retry > 0UL));
+    _MTB_HAL_PERF_BUSY_END(obj);
+    _MTB_HAL_PERF_ADD(obj, transfers, 1U);
 
     if (CY_RSLT_SUCCESS != result)
     {
         /* Transfer failed */
         sdxx->data_transfer_status = _MTB_HAL_SDXX_NOT_RUNNING;
+        _MTB_HAL_PERF_ADD(obj, errors, 1U);
+        _MTB_HAL_PERF_TRACE(MTB_HAL_RSLT_MODULE_SDIO, MTB_HAL_PERF_EVENT_ERROR, obj, result);
+    }
+    else
+    {
+        _MTB_HAL_PERF_ADD(obj, bytes, length);
     }
 
     // Invalidate dcache if enabled to update dcache's contents after DMA transfer
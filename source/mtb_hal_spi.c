@@ -58,6 +58,11 @@
 #include "mtb_hal_spi.h"
 #include "mtb_hal_system_impl.h"
 #include "mtb_hal_utils.h"
+#include "mtb_hal_scb_common.h"
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+#include "mtb_hal_dma.h"
+#include "mtb_hal_gpio.h"
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
 
 #if (MTB_HAL_DRIVER_AVAILABLE_SPI)
 
@@ -73,10 +78,138 @@ extern "C"
 
 /** The maximum allowable tolerance in PPM on the SPI clock frequency **/
 #define MTB_HAL_SPI_CLOCK_FREQ_MAX_TOLERANCE_PPM (20000UL)
+
+/* PDL transfer status flags which mark a failed transfer */
+#define _MTB_HAL_SPI_TRANSFER_ERRORS \
+    (CY_SCB_SPI_TRANSFER_OVERFLOW | CY_SCB_SPI_TRANSFER_UNDERFLOW | CY_SCB_SPI_SLAVE_TRANSFER_ERR)
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+/* RX DMA events handled by the driver: completion of the whole transfer and all error causes */
+#define _MTB_HAL_SPI_DMA_RX_EVENTS \
+    ((mtb_hal_dma_event_t)(MTB_HAL_DMA_DESCRIPTOR_COMPLETE | MTB_HAL_DMA_SRC_BUS_ERROR | \
+                           MTB_HAL_DMA_DST_BUS_ERROR | MTB_HAL_DMA_SRC_MISAL | \
+                           MTB_HAL_DMA_DST_MISAL | MTB_HAL_DMA_CURR_PTR_NULL | \
+                           MTB_HAL_DMA_ACTIVE_CH_DISABLED | MTB_HAL_DMA_DESCR_BUS_ERROR | \
+                           MTB_HAL_DMA_GENERIC_ERROR))
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+#include "cyabs_rtos.h"
+
+typedef enum
+{
+    /* Semaphore is not initialized */
+    _MTB_HAL_SPI_SEMA_NOT_INITED,
+    /* Semaphore is initialized, but will not be used */
+    _MTB_HAL_SPI_SEMA_NOT_USED,
+    /* Semaphore is initialized and used (expected to be set in IRQ handler) */
+    _MTB_HAL_SPI_SEMA_USED,
+    /* Set in irq handler */
+    _MTB_HAL_SPI_SEMA_SET
+} _mtb_hal_spi_semaphore_status_t;
+
+/* mtb_hal_spi_t would be the better place for keeping these items, but since cy_semaphore_t
+ * depends on cyabs_rtos.h that results in circular includes/messy forward declarations. */
+static cy_semaphore_t _mtb_hal_spi_semaphore_xfer_done[_MTB_HAL_SCB_INSTANCES];
+static _mtb_hal_spi_semaphore_status_t _mtb_hal_spi_semaphore_status[_MTB_HAL_SCB_INSTANCES];
+#endif /* defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE) */
+
 /*******************************************************************************
 *       internal Functions
 *******************************************************************************/
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_setup_smphr
+//--------------------------------------------------------------------------------------------------
+/* Indicates that a blocking transfer is about to start so its completion wakes up the caller */
+static void _mtb_hal_spi_setup_smphr(mtb_hal_spi_t* obj)
+{
+    #if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    uint32_t block_num = _mtb_hal_scb_get_block_index(obj->base);
+    bool in_isr = (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) != 0;
+    if (!in_isr)
+    {
+        cy_rslt_t result = CY_RSLT_SUCCESS;
+        if (_MTB_HAL_SPI_SEMA_NOT_INITED == _mtb_hal_spi_semaphore_status[block_num])
+        {
+            result = cy_rtos_init_semaphore(&(_mtb_hal_spi_semaphore_xfer_done[block_num]), 1, 0);
+        }
+        else if (_MTB_HAL_SPI_SEMA_SET == _mtb_hal_spi_semaphore_status[block_num])
+        {
+            /* A previous wait timed out before the transfer completed. Clear the semaphore in
+             * order to prepare it for this transfer. */
+            result = cy_rtos_get_semaphore(&(_mtb_hal_spi_semaphore_xfer_done[block_num]), 0,
+                                           false);
+        }
+        _mtb_hal_spi_semaphore_status[block_num] = (CY_RSLT_SUCCESS == result)
+            ? _MTB_HAL_SPI_SEMA_USED
+            : _MTB_HAL_SPI_SEMA_NOT_USED;
+    }
+    else if (_MTB_HAL_SPI_SEMA_NOT_INITED != _mtb_hal_spi_semaphore_status[block_num])
+    {
+        _mtb_hal_spi_semaphore_status[block_num] = _MTB_HAL_SPI_SEMA_NOT_USED;
+    }
+    #else // if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    // We don't need to do anything special if we're not in an RTOS context
+    CY_UNUSED_PARAMETER(obj);
+    #endif // if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_xfer_done
+//--------------------------------------------------------------------------------------------------
+/* Marks the transfer on the bus as finished. Called from interrupt context. */
+static void _mtb_hal_spi_xfer_done(mtb_hal_spi_t* obj)
+{
+    obj->pending = _MTB_HAL_SPI_PENDING_NONE;
+    #if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    uint32_t block_num = _mtb_hal_scb_get_block_index(obj->base);
+    if (_MTB_HAL_SPI_SEMA_USED == _mtb_hal_spi_semaphore_status[block_num])
+    {
+        _mtb_hal_spi_semaphore_status[block_num] = _MTB_HAL_SPI_SEMA_SET;
+        (void)cy_rtos_set_semaphore(&(_mtb_hal_spi_semaphore_xfer_done[block_num]), true);
+    }
+    #endif /* defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE) */
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_waitfor_xfer_done
+//--------------------------------------------------------------------------------------------------
+/* Waits for a transfer started after _mtb_hal_spi_setup_smphr. With an RTOS the calling task
+ * sleeps until the interrupt handler reports completion; otherwise, or when called from an
+ * interrupt, the pending flag is polled. A timeout is only applied while sleeping. */
+static cy_rslt_t _mtb_hal_spi_waitfor_xfer_done(mtb_hal_spi_t* obj, uint32_t timeout_ms)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    #if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    uint32_t block_num = _mtb_hal_scb_get_block_index(obj->base);
+    bool in_isr = (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) != 0;
+    if ((!in_isr) && ((_MTB_HAL_SPI_SEMA_USED == _mtb_hal_spi_semaphore_status[block_num]) ||
+                      (_MTB_HAL_SPI_SEMA_SET == _mtb_hal_spi_semaphore_status[block_num])))
+    {
+        result = cy_rtos_get_semaphore(&(_mtb_hal_spi_semaphore_xfer_done[block_num]), timeout_ms,
+                                       false);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            _mtb_hal_spi_semaphore_status[block_num] = _MTB_HAL_SPI_SEMA_NOT_USED;
+        }
+    }
+    else
+    #else
+    CY_UNUSED_PARAMETER(timeout_ms);
+    #endif // if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    {
+        while (obj->pending != _MTB_HAL_SPI_PENDING_NONE)
+        {
+        }
+    }
+    return result;
+}
+
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_spi_readable
 //--------------------------------------------------------------------------------------------------
@@ -126,6 +259,113 @@ static bool _mtb_hal_check_spi_status(void* obj, uint32_t op)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_put_get_failed
+//--------------------------------------------------------------------------------------------------
+/* A frame was lost or a FIFO was accessed out of range since the error flags were cleared */
+static bool _mtb_hal_spi_put_get_failed(CySCB_Type* base)
+{
+    return (0UL != (Cy_SCB_GetRxInterruptStatus(base) &
+                    (CY_SCB_RX_INTR_OVERFLOW | CY_SCB_RX_INTR_UNDERFLOW))) ||
+           (0UL != (Cy_SCB_GetTxInterruptStatus(base) & CY_SCB_TX_INTR_OVERFLOW));
+}
+
+
+/* Polled full-duplex exchange of `count` frames held in elements of `type`. Up to a FIFO depth
+ * of frames is kept in flight, so the TX FIFO never runs dry while the RX FIFO cannot overflow.
+ * A NULL tx sends `fill`, a NULL rx drops the received frames. Waiting for received frames is
+ * bounded by `timeout` ms unless it is 0. */
+#define _MTB_HAL_SPI_PUT_GET(type)                                                              \
+    static cy_rslt_t _mtb_hal_spi_put_get_##type(CySCB_Type* base, const void* tx, void* rx,    \
+                                                 size_t count, uint32_t fill, uint32_t timeout) \
+    {                                                                                           \
+        const type* src = (const type*)tx;                                                      \
+        type* dst = (type*)rx;                                                                  \
+        size_t depth = (size_t)Cy_SCB_GetFifoSize(base);                                        \
+        size_t sent = 0U;                                                                       \
+        size_t received = 0U;                                                                   \
+        uint32_t waited_us = 0U;                                                                \
+        while (received < count)                                                                \
+        {                                                                                       \
+            while ((sent < count) && ((sent - received) < depth))                               \
+            {                                                                                   \
+                SCB_TX_FIFO_WR(base) = (NULL != src) ? (uint32_t)src[sent] : fill;              \
+                ++sent;                                                                         \
+            }                                                                                   \
+            if (0UL != Cy_SCB_GetNumInRxFifo(base))                                             \
+            {                                                                                   \
+                uint32_t value = SCB_RX_FIFO_RD(base);                                          \
+                if (NULL != dst)                                                                \
+                {                                                                               \
+                    dst[received] = (type)value;                                                \
+                }                                                                               \
+                ++received;                                                                     \
+            }                                                                                   \
+            else if (_mtb_hal_spi_put_get_failed(base))                                         \
+            {                                                                                   \
+                return MTB_HAL_SPI_RSLT_TRANSFER_ERROR;                                         \
+            }                                                                                   \
+            else if (0U != timeout)                                                             \
+            {                                                                                   \
+                mtb_hal_system_delay_us(_MTB_HAL_UTILS_ONE_TIME_UNIT);                          \
+                if (++waited_us == (uint32_t)_MTB_HAL_UTILS_US_PER_MS)                          \
+                {                                                                               \
+                    waited_us = 0U;                                                             \
+                    if (0U == --timeout)                                                        \
+                    {                                                                           \
+                        return MTB_HAL_SPI_RSLT_TIMEOUT;                                        \
+                    }                                                                           \
+                }                                                                               \
+            }                                                                                   \
+        }                                                                                       \
+        return _mtb_hal_spi_put_get_failed(base)                                                \
+            ? MTB_HAL_SPI_RSLT_TRANSFER_ERROR                                                   \
+            : CY_RSLT_SUCCESS;                                                                  \
+    }
+
+_MTB_HAL_SPI_PUT_GET(uint8_t)
+_MTB_HAL_SPI_PUT_GET(uint16_t)
+_MTB_HAL_SPI_PUT_GET(uint32_t)
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_bind_width
+//--------------------------------------------------------------------------------------------------
+/* Selects the per-width buffer handling once, so transfers do not re-derive it */
+static void _mtb_hal_spi_bind_width(mtb_hal_spi_t* obj)
+{
+    if (obj->data_bits <= 8U)
+    {
+        obj->word_shift = 0U;
+        obj->put_get = _mtb_hal_spi_put_get_uint8_t;
+    }
+    else if (obj->data_bits <= 16U)
+    {
+        obj->word_shift = 1U;
+        obj->put_get = _mtb_hal_spi_put_get_uint16_t;
+    }
+    else
+    {
+        obj->word_shift = 2U;
+        obj->put_get = _mtb_hal_spi_put_get_uint32_t;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_is_streaming
+//--------------------------------------------------------------------------------------------------
+static bool _mtb_hal_spi_is_streaming(mtb_hal_spi_t* obj)
+{
+    #if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+    return (NULL != obj->stream.select);
+    #else
+    CY_UNUSED_PARAMETER(obj);
+    return false;
+    #endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_spi_put_get
 //--------------------------------------------------------------------------------------------------
@@ -168,51 +408,128 @@ static cy_rslt_t _mtb_hal_spi_put_get(mtb_hal_spi_t* obj, uint32_t fill, bool pu
 
 
 //--------------------------------------------------------------------------------------------------
-// _mtb_hal_spi_transfer_async
+// _mtb_hal_spi_set_data_width
 //--------------------------------------------------------------------------------------------------
-static cy_rslt_t _mtb_hal_spi_transfer_async(mtb_hal_spi_t* obj, const uint8_t* tx,
-                                             size_t tx_length, uint8_t* rx, size_t rx_length)
+static cy_rslt_t _mtb_hal_spi_set_data_width(mtb_hal_spi_t* obj, uint8_t data_bits)
 {
-    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
-    CY_ASSERT_AND_RETURN(obj != NULL, MTB_HAL_SPI_RSLT_BAD_ARGUMENT);
+    #if defined(CY_IP_MXSCB) && (CY_IP_MXSCB_VERSION >= 2)
+    /* In byte mode the FIFO entries are only 8 bits wide */
+    uint8_t max_bits = _FLD2BOOL(SCB_CTRL_BYTE_MODE, SCB_CTRL(obj->base)) ? 8U : 32U;
     #else
-    if (NULL == obj)
+    uint8_t max_bits = 16U;
+    #endif
+
+    if ((data_bits < 4U) || (data_bits > max_bits))
     {
         return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
     }
-    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
 
-    cy_en_scb_spi_status_t spi_status = CY_SCB_SPI_SUCCESS;
+    /* The block stays enabled, disabling it would reset the FIFOs and glitch the outputs from
+     * interrupt context. The width is therefore only changed between frames, with nothing left in
+     * either FIFO and the bus idle. */
+    if ((!Cy_SCB_SPI_IsTxComplete(obj->base)) || (0UL != Cy_SCB_SPI_GetNumInRxFifo(obj->base)) ||
+        Cy_SCB_SPI_IsBusBusy(obj->base))
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+    CY_REG32_CLR_SET(SCB_TX_CTRL(obj->base), SCB_TX_CTRL_DATA_WIDTH, (uint32_t)data_bits - 1UL);
+    CY_REG32_CLR_SET(SCB_RX_CTRL(obj->base), SCB_RX_CTRL_DATA_WIDTH, (uint32_t)data_bits - 1UL);
+    obj->data_bits = data_bits;
+    _mtb_hal_spi_bind_width(obj);
 
-    obj->is_async = true;
+    return CY_RSLT_SUCCESS;
+}
+
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_transfer_dma
+//--------------------------------------------------------------------------------------------------
+/* Full-duplex transfer of `words` frames moved by the configured DMA channels. The RX channel is
+ * armed first so nothing is lost once the TX channel starts filling the FIFO. */
+static cy_rslt_t _mtb_hal_spi_transfer_dma(mtb_hal_spi_t* obj, const uint8_t* tx, uint8_t* rx,
+                                           size_t words, size_t length)
+{
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void*)tx, (int32_t)length);
+    SCB_InvalidateDCache_by_Addr((void*)rx, (int32_t)length);
+    #else
+    CY_UNUSED_PARAMETER(length);
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
 
-    uint8_t arr_size_modifier = 0;
-    if (obj->data_bits <= 8)
+    Cy_SCB_SPI_ClearRxFifo(obj->base);
+    /* Request an RX transfer per received frame and keep the TX FIFO half full */
+    Cy_SCB_SetRxFifoLevel(obj->base, 0UL);
+    Cy_SCB_SetTxFifoLevel(obj->base, Cy_SCB_GetFifoSize(obj->base) / 2UL);
+
+    obj->is_dma = true;
+    /* RX is armed first so that no frame clocked in by the TX data is missed */
+    cy_rslt_t result = mtb_hal_dma_set_transfer(obj->dma_rx, (uint32_t)&(obj->base->RX_FIFO_RD),
+                                                (uint32_t)rx, (uint32_t)words, true);
+    if (CY_RSLT_SUCCESS == result)
     {
-        arr_size_modifier = 1;
+        result = mtb_hal_dma_set_transfer(obj->dma_tx, (uint32_t)tx,
+                                          (uint32_t)&(obj->base->TX_FIFO_WR), (uint32_t)words,
+                                          true);
     }
-    else if (obj->data_bits <= 16)
+
+    if (CY_RSLT_SUCCESS != result)
     {
-        arr_size_modifier = 2;
+        (void)mtb_hal_dma_disable(obj->dma_rx);
+        obj->is_dma = false;
     }
-    else
+    return result;
+}
+
+
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_transfer_async
+//--------------------------------------------------------------------------------------------------
+static cy_rslt_t _mtb_hal_spi_transfer_async(mtb_hal_spi_t* obj, const uint8_t* tx,
+                                             size_t tx_length, uint8_t* rx, size_t rx_length)
+{
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(obj != NULL, MTB_HAL_SPI_RSLT_BAD_ARGUMENT);
+    #else
+    if (NULL == obj)
     {
-        arr_size_modifier = 4;
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
     }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
 
-    if ((tx_length % arr_size_modifier != 0) || (rx_length % arr_size_modifier != 0))
+    cy_en_scb_spi_status_t spi_status = CY_SCB_SPI_SUCCESS;
+
+    if (0U != ((tx_length | rx_length) & ((1UL << obj->word_shift) - 1UL)))
     {
         return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
     }
 
-    size_t tx_words = tx_length / arr_size_modifier;
-    size_t rx_words = rx_length / arr_size_modifier;
+    obj->is_async = true;
+
+    size_t tx_words = tx_length >> obj->word_shift;
+    size_t rx_words = rx_length >> obj->word_shift;
 
     /* Setup transfer */
     obj->rx_buffer = NULL;
     obj->tx_buffer = NULL;
 
-    CY_UNUSED_PARAMETER(arr_size_modifier);
+    #if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+    if ((NULL != obj->dma_rx) && (NULL != tx) && (NULL != rx) && (0U != tx_words) &&
+        (tx_words == rx_words))
+    {
+        /* Completion is reported by the RX DMA channel, not by the PDL */
+        obj->is_async = false;
+        obj->pending = _MTB_HAL_SPI_PENDING_TX_RX;
+        cy_rslt_t result = _mtb_hal_spi_transfer_dma(obj, tx, rx, tx_words, tx_length);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            obj->pending = _MTB_HAL_SPI_PENDING_NONE;
+        }
+        return result;
+    }
+    #endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+
     if (tx_words != rx_words)
     {
         if (tx_words == 0)
@@ -244,10 +561,219 @@ static cy_rslt_t _mtb_hal_spi_transfer_async(mtb_hal_spi_t* obj, const uint8_t*
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_queue_issue
+//--------------------------------------------------------------------------------------------------
+/* Applies the per-transfer settings of the descriptor at the head of the queue and starts it */
+static cy_rslt_t _mtb_hal_spi_queue_issue(mtb_hal_spi_t* obj)
+{
+    mtb_hal_spi_xfer_desc_t* desc = obj->queue.storage[obj->queue.head];
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if ((0U != desc->data_bits) && (desc->data_bits != obj->data_bits))
+    {
+        result = _mtb_hal_spi_set_data_width(obj, desc->data_bits);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        Cy_SCB_SPI_SetActiveSlaveSelect(obj->base,
+                                        (cy_en_scb_spi_slave_select_t)desc->target_select);
+        obj->write_fill = desc->write_fill;
+        result = _mtb_hal_spi_transfer_async(obj, desc->tx, desc->tx_length, desc->rx,
+                                             desc->rx_length);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        obj->pending = _MTB_HAL_SPI_PENDING_NONE;
+        obj->is_async = false;
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_queue_complete
+//--------------------------------------------------------------------------------------------------
+/* Retires the descriptor at the head of the queue. The next transfer is started before the
+ * callback runs so the bus does not sit idle while the application handles the result. */
+static void _mtb_hal_spi_queue_complete(mtb_hal_spi_t* obj, cy_rslt_t result)
+{
+    _mtb_hal_spi_queue_t* queue = &(obj->queue);
+    while (0U != queue->count)
+    {
+        mtb_hal_spi_xfer_desc_t* done = queue->storage[queue->head];
+        queue->head = (uint8_t)((queue->head + 1U) % queue->size);
+        queue->count--;
+
+        cy_rslt_t next = (0U != queue->count)
+            ? _mtb_hal_spi_queue_issue(obj)
+            : CY_RSLT_SUCCESS;
+
+        done->result = result;
+        done->complete = true;
+        if (NULL != done->callback)
+        {
+            done->callback(done->callback_arg, done);
+        }
+
+        if (CY_RSLT_SUCCESS == next)
+        {
+            break;
+        }
+        /* The next transfer could not be started, retire it too */
+        result = next;
+    }
+}
+
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_dma_rx_event_callback
+//--------------------------------------------------------------------------------------------------
+/* The last frame has been received once the RX channel completes, so the transfer is done */
+static void _mtb_hal_spi_dma_rx_event_callback(void* callback_arg, mtb_hal_dma_event_t event)
+{
+    mtb_hal_spi_t* obj = (mtb_hal_spi_t*)callback_arg;
+    if (NULL != obj->stream.select)
+    {
+        /* The receive buffer is full or the channel failed; the frame is reported as overflowed
+           once it ends */
+        obj->stream.overflow = true;
+        return;
+    }
+    if (!obj->is_dma)
+    {
+        return;
+    }
+
+    (void)mtb_hal_dma_disable(obj->dma_tx);
+    (void)mtb_hal_dma_disable(obj->dma_rx);
+    obj->is_dma = false;
+    _mtb_hal_spi_xfer_done(obj);
+
+    bool success = (MTB_HAL_DMA_DESCRIPTOR_COMPLETE == event);
+    mtb_hal_spi_event_t user_event = (mtb_hal_spi_event_t)(obj->irq_cause &
+                                                           (success ? MTB_HAL_SPI_IRQ_DONE :
+                                                            MTB_HAL_SPI_IRQ_ERROR));
+    if (MTB_HAL_SPI_EVENT_NONE != user_event)
+    {
+        mtb_hal_spi_event_callback_t callback =
+            (mtb_hal_spi_event_callback_t)obj->callback_data.callback;
+        callback(obj->callback_data.callback_arg, user_event);
+    }
+
+    if (0U != obj->queue.count)
+    {
+        _mtb_hal_spi_queue_complete(obj,
+                                    success ? CY_RSLT_SUCCESS : MTB_HAL_SPI_RSLT_TRANSFER_ERROR);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_stream_arm
+//--------------------------------------------------------------------------------------------------
+/* Points the RX channel at the active receive buffer and restarts the TX data from its start */
+static cy_rslt_t _mtb_hal_spi_stream_arm(mtb_hal_spi_t* obj)
+{
+    _mtb_hal_spi_stream_t* stream = &(obj->stream);
+    uint8_t* rx = stream->rx_buffer[stream->active];
+    uint32_t word_size = (1UL << obj->word_shift);
+
+    stream->overflow = false;
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* No dirty line may be evicted over the frame the DMA writes. Lines speculatively refilled
+     * while it does are dropped again when the frame ends, overflowed or not. */
+    SCB_InvalidateDCache_by_Addr((void*)rx, (int32_t)stream->size);
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+
+    cy_rslt_t result = mtb_hal_dma_set_transfer(obj->dma_rx, (uint32_t)&(obj->base->RX_FIFO_RD),
+                                                (uint32_t)rx, (uint32_t)(stream->size / word_size),
+                                                true);
+
+    /* Anything left from the previous frame must not be sent at the start of the next one */
+    Cy_SCB_SPI_ClearTxFifo(obj->base);
+    if ((CY_RSLT_SUCCESS == result) && (NULL != obj->dma_tx) && (NULL != stream->tx))
+    {
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_CleanDCache_by_Addr((void*)stream->tx, (int32_t)stream->tx_length);
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+        result = mtb_hal_dma_set_transfer(obj->dma_tx, (uint32_t)stream->tx,
+                                          (uint32_t)&(obj->base->TX_FIFO_WR),
+                                          (uint32_t)(stream->tx_length / word_size), true);
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_stream_frame_end
+//--------------------------------------------------------------------------------------------------
+/* Target select went inactive: retire the active buffer and switch the channels to the other one
+ * before the host can start the next frame */
+static void _mtb_hal_spi_stream_frame_end(void* callback_arg, mtb_hal_gpio_event_t event)
+{
+    CY_UNUSED_PARAMETER(event);
+    mtb_hal_spi_t* obj = (mtb_hal_spi_t*)callback_arg;
+    _mtb_hal_spi_stream_t* stream = &(obj->stream);
+    if (NULL == stream->select)
+    {
+        return;
+    }
+
+    uint8_t* rx = stream->rx_buffer[stream->active];
+    uint32_t word_size = (1UL << obj->word_shift);
+    uint32_t capacity = (uint32_t)(stream->size / word_size);
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    uint32_t words;
+
+    (void)mtb_hal_dma_disable(obj->dma_rx);
+    if (NULL != obj->dma_tx)
+    {
+        (void)mtb_hal_dma_disable(obj->dma_tx);
+    }
+
+    bool overflow = stream->overflow;
+    words = overflow ? capacity : mtb_hal_dma_get_transfer_index(obj->dma_rx);
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* Drop stale lines of what the DMA wrote before the CPU appends to it or the application reads
+     * it, also when the frame overflowed */
+    SCB_InvalidateDCache_by_Addr((void*)rx, (int32_t)(words * word_size));
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+
+    if (overflow)
+    {
+        status = MTB_HAL_SPI_RSLT_BUFFER_OVERFLOW;
+    }
+    else
+    {
+        /* The last frames may have arrived after the last DMA request was served */
+        words += Cy_SCB_SPI_ReadArray(obj->base, (void*)&rx[words * word_size], capacity - words);
+        if (0U != Cy_SCB_SPI_GetNumInRxFifo(obj->base))
+        {
+            status = MTB_HAL_SPI_RSLT_BUFFER_OVERFLOW;
+        }
+    }
+    Cy_SCB_SPI_ClearRxFifo(obj->base);
+
+    stream->active ^= 1U;
+    if (CY_RSLT_SUCCESS != _mtb_hal_spi_stream_arm(obj))
+    {
+        /* Let the next frame end report the failure instead of silently losing it */
+        stream->overflow = true;
+    }
+
+    mtb_hal_spi_target_frame_callback_t callback =
+        (mtb_hal_spi_target_frame_callback_t)stream->callback_data.callback;
+    callback(stream->callback_data.callback_arg, rx, (size_t)(words * word_size), status);
+}
+
+
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+
 /*******************************************************************************
 *       External Functions
 *******************************************************************************/
-static volatile mtb_hal_spi_t* _mtb_hal_spi_irq_obj = NULL;
 
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_spi_setup
@@ -264,6 +790,7 @@ cy_rslt_t mtb_hal_spi_setup(mtb_hal_spi_t* obj, const mtb_hal_spi_configurator_t
     obj->context = context;
     obj->is_target = (bool)!config->config->spiMode;
     obj->data_bits = config->config->txDataWidth;
+    _mtb_hal_spi_bind_width(obj);
     obj->irq_cause = MTB_HAL_SPI_EVENT_NONE;
 
     return CY_RSLT_SUCCESS;
@@ -371,6 +898,50 @@ cy_rslt_t mtb_hal_spi_put(mtb_hal_spi_t* obj, uint32_t value)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_put_get_array
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_put_get_array(mtb_hal_spi_t* obj, const void* tx, void* rx, size_t count,
+                                    uint32_t write_fill, uint32_t timeout)
+{
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(obj != NULL, MTB_HAL_SPI_RSLT_BAD_ARGUMENT);
+    CY_ASSERT_AND_RETURN(((!obj->is_target) && (0U != count) && ((NULL != tx) || (NULL != rx)) &&
+                          (0U == (((uintptr_t)tx | (uintptr_t)rx) &
+                                  ((1UL << obj->word_shift) - 1UL)))),
+                         MTB_HAL_SPI_RSLT_BAD_ARGUMENT);
+    #else
+    if (NULL == obj)
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+    /* Only a controller drives the clock the polled exchange relies on, and the buffers are
+     * accessed as elements of the data width */
+    if (obj->is_target || (0U == count) || ((NULL == tx) && (NULL == rx)) ||
+        (0U != (((uintptr_t)tx | (uintptr_t)rx) & ((1UL << obj->word_shift) - 1UL))))
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+
+    if ((_MTB_HAL_SPI_PENDING_NONE != obj->pending) || (0U != obj->queue.count) ||
+        _mtb_hal_spi_is_streaming(obj))
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
+    Cy_SCB_ClearRxInterrupt(obj->base, CY_SCB_RX_INTR_OVERFLOW | CY_SCB_RX_INTR_UNDERFLOW);
+    Cy_SCB_ClearTxInterrupt(obj->base, CY_SCB_TX_INTR_OVERFLOW);
+    cy_rslt_t result = obj->put_get(obj->base, tx, rx, count, write_fill, timeout);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        /* Frames still in flight do not belong to the next exchange */
+        mtb_hal_spi_clear(obj);
+    }
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_spi_target_read
 //--------------------------------------------------------------------------------------------------
@@ -379,6 +950,11 @@ cy_rslt_t mtb_hal_spi_target_read(mtb_hal_spi_t* obj, uint8_t* dst_buff, uint16_
 {
     cy_rslt_t status = MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
 
+    if (_mtb_hal_spi_is_streaming(obj))
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN(((dst_buff != NULL) && (size != NULL)), MTB_HAL_SPI_RSLT_BAD_ARGUMENT);
     #else
@@ -434,10 +1010,25 @@ cy_rslt_t mtb_hal_spi_target_write(mtb_hal_spi_t* obj, const uint8_t* src_buff,
 {
     cy_rslt_t status = MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
 
+    if (_mtb_hal_spi_is_streaming(obj))
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
     if ((src_buff != NULL) && (size != NULL))
     {
+        _mtb_hal_spi_setup_smphr(obj);
         status = _mtb_hal_spi_transfer_async(obj, src_buff, (size_t)*size, NULL, 0U);
 
+        #if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+        if ((CY_RSLT_SUCCESS == status) && (timeout > 0U))
+        {
+            /* Sleep until the data has been moved into the FIFO; the remaining frames take at
+               most a FIFO's worth of bus time to shift out */
+            status = _mtb_hal_spi_waitfor_xfer_done(obj, timeout);
+        }
+        #endif // if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+
         if (CY_RSLT_SUCCESS == status)
         {
             /* Wait until the target finish writing */
@@ -471,14 +1062,22 @@ cy_rslt_t mtb_hal_spi_transfer(mtb_hal_spi_t* obj, const uint8_t* tx, size_t tx_
     }
     #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
 
+    if ((0U != obj->queue.count) || _mtb_hal_spi_is_streaming(obj))
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
     obj->write_fill = write_fill;
+    _mtb_hal_spi_setup_smphr(obj);
     cy_rslt_t rslt = _mtb_hal_spi_transfer_async(obj, tx, tx_length, rx, rx_length);
     if (rslt == CY_RSLT_SUCCESS)
     {
-        while (obj->pending != _MTB_HAL_SPI_PENDING_NONE)
-        {
-        }                                                     /* Wait for async transfer to complete
-                                                               */
+        /* Wait for async transfer to complete */
+        #if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+        rslt = _mtb_hal_spi_waitfor_xfer_done(obj, CY_RTOS_NEVER_TIMEOUT);
+        #else
+        rslt = _mtb_hal_spi_waitfor_xfer_done(obj, 0U);
+        #endif
     }
     obj->write_fill = (uint8_t)CY_SCB_SPI_DEFAULT_TX;
 
@@ -486,6 +1085,367 @@ cy_rslt_t mtb_hal_spi_transfer(mtb_hal_spi_t* obj, const uint8_t* tx, size_t tx_
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_transfer_async
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_transfer_async(mtb_hal_spi_t* obj, const uint8_t* tx, size_t tx_length,
+                                     uint8_t* rx, size_t rx_length, uint8_t write_fill)
+{
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(obj != NULL, MTB_HAL_SPI_RSLT_BAD_ARGUMENT);
+    #else
+    if (NULL == obj)
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+
+    cy_rslt_t rslt = MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if ((_MTB_HAL_SPI_PENDING_NONE == obj->pending) && (0U == obj->queue.count) &&
+        !_mtb_hal_spi_is_streaming(obj))
+    {
+        obj->write_fill = write_fill;
+        rslt = _mtb_hal_spi_transfer_async(obj, tx, tx_length, rx, rx_length);
+        if (CY_RSLT_SUCCESS != rslt)
+        {
+            obj->pending = _MTB_HAL_SPI_PENDING_NONE;
+            obj->is_async = false;
+        }
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    return rslt;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_abort_async
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_abort_async(mtb_hal_spi_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    if ((0U != obj->queue.count) || _mtb_hal_spi_is_streaming(obj))
+    {
+        /* Owned by the queue or the stream, which have their own stop functions */
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    #if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+    if (obj->is_dma)
+    {
+        (void)mtb_hal_dma_disable(obj->dma_tx);
+        (void)mtb_hal_dma_disable(obj->dma_rx);
+        obj->is_dma = false;
+        mtb_hal_spi_clear(obj);
+    }
+    else
+    #endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+    if (obj->is_async)
+    {
+        Cy_SCB_SPI_AbortTransfer(obj->base, obj->context);
+    }
+    obj->is_async = false;
+    obj->pending = _MTB_HAL_SPI_PENDING_NONE;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_config_dma
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_config_dma(mtb_hal_spi_t* obj, mtb_hal_dma_t* dma_rx, mtb_hal_dma_t* dma_tx)
+{
+    CY_ASSERT(NULL != obj);
+
+    if ((NULL == dma_rx) != (NULL == dma_tx))
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+    if ((_MTB_HAL_SPI_PENDING_NONE != obj->pending) || (NULL != obj->stream.select))
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
+    if (NULL != obj->dma_rx)
+    {
+        mtb_hal_dma_enable_event(obj->dma_rx, _MTB_HAL_SPI_DMA_RX_EVENTS, false);
+    }
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->dma_rx = dma_rx;
+    obj->dma_tx = dma_tx;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    if (NULL != dma_rx)
+    {
+        mtb_hal_dma_register_callback(dma_rx, _mtb_hal_spi_dma_rx_event_callback, obj);
+        mtb_hal_dma_enable_event(dma_rx, _MTB_HAL_SPI_DMA_RX_EVENTS, true);
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_target_stream_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_target_stream_start(mtb_hal_spi_t* obj, mtb_hal_gpio_t* select,
+                                          uint8_t* rx_buffer0, uint8_t* rx_buffer1, size_t size,
+                                          mtb_hal_spi_target_frame_callback_t callback,
+                                          void* callback_arg)
+{
+    CY_ASSERT(NULL != obj);
+
+    uint32_t word_size = (1UL << obj->word_shift);
+    if (!obj->is_target || (NULL == obj->dma_rx) || (NULL == select) || (NULL == rx_buffer0) ||
+        (NULL == rx_buffer1) || (0U == size) || (0U != (size % word_size)) || (NULL == callback))
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+    if ((_MTB_HAL_SPI_PENDING_NONE != obj->pending) || (NULL != obj->stream.select))
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
+    _mtb_hal_spi_stream_t* stream = &(obj->stream);
+    stream->rx_buffer[0] = rx_buffer0;
+    stream->rx_buffer[1] = rx_buffer1;
+    stream->size = size;
+    stream->active = 0U;
+    stream->callback_data.callback = (cy_israddress)callback;
+    stream->callback_data.callback_arg = callback_arg;
+
+    /* Request an RX transfer per received frame and keep the TX FIFO half full */
+    Cy_SCB_SPI_ClearRxFifo(obj->base);
+    Cy_SCB_SetRxFifoLevel(obj->base, 0UL);
+    Cy_SCB_SetTxFifoLevel(obj->base, Cy_SCB_GetFifoSize(obj->base) / 2UL);
+
+    cy_rslt_t result = _mtb_hal_spi_stream_arm(obj);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+        stream->select = select;
+        obj->pending = _MTB_HAL_SPI_PENDING_RX;
+        mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+        mtb_hal_gpio_register_callback(select, _mtb_hal_spi_stream_frame_end, obj);
+        mtb_hal_gpio_enable_event(select, MTB_HAL_GPIO_IRQ_RISE, true);
+    }
+    else
+    {
+        (void)mtb_hal_dma_disable(obj->dma_rx);
+        if (NULL != obj->dma_tx)
+        {
+            (void)mtb_hal_dma_disable(obj->dma_tx);
+        }
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_target_stream_set_tx
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_target_stream_set_tx(mtb_hal_spi_t* obj, const uint8_t* tx, size_t length)
+{
+    CY_ASSERT(NULL != obj);
+
+    uint32_t word_size = (1UL << obj->word_shift);
+    if ((NULL == obj->dma_tx) ||
+        ((NULL != tx) && ((0U == length) || (0U != (length % word_size)))))
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->stream.tx = tx;
+    obj->stream.tx_length = length;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_target_stream_stop
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_target_stream_stop(mtb_hal_spi_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    mtb_hal_gpio_t* select = obj->stream.select;
+    if (NULL == select)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+    mtb_hal_gpio_enable_event(select, MTB_HAL_GPIO_IRQ_RISE, false);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->stream.select = NULL;
+    (void)mtb_hal_dma_disable(obj->dma_rx);
+    if (NULL != obj->dma_tx)
+    {
+        (void)mtb_hal_dma_disable(obj->dma_tx);
+    }
+    mtb_hal_spi_clear(obj);
+    obj->pending = _MTB_HAL_SPI_PENDING_NONE;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_queue_start
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_queue_start(mtb_hal_spi_t* obj, mtb_hal_spi_xfer_desc_t** storage,
+                                  uint8_t size)
+{
+    CY_ASSERT(NULL != obj);
+
+    if (obj->is_target || (NULL == storage) || (0U == size))
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+    if (0U != obj->queue.count)
+    {
+        return MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->queue.storage = storage;
+    obj->queue.size    = size;
+    obj->queue.head    = 0U;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_queue_submit
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_queue_submit(mtb_hal_spi_t* obj, mtb_hal_spi_xfer_desc_t* desc)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != desc);
+
+    _mtb_hal_spi_queue_t* queue = &(obj->queue);
+    if ((NULL == queue->storage) || (desc->target_select > 3U) ||
+        ((0U == desc->tx_length) && (0U == desc->rx_length)) ||
+        ((0U != desc->tx_length) && (NULL == desc->tx)) ||
+        ((0U != desc->rx_length) && (NULL == desc->rx)))
+    {
+        return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+
+    desc->complete = false;
+    desc->result = CY_RSLT_SUCCESS;
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (queue->count == queue->size)
+    {
+        result = MTB_HAL_SPI_RSLT_QUEUE_FULL;
+    }
+    else if ((0U == queue->count) && (_MTB_HAL_SPI_PENDING_NONE != obj->pending))
+    {
+        /* A transfer outside of the queue is using the bus */
+        result = MTB_HAL_SPI_RSLT_DEVICE_BUSY;
+    }
+    else
+    {
+        queue->storage[(queue->head + queue->count) % queue->size] = desc;
+        queue->count++;
+        if (1U == queue->count)
+        {
+            /* Bus is idle */
+            cy_rslt_t status = _mtb_hal_spi_queue_issue(obj);
+            if (CY_RSLT_SUCCESS != status)
+            {
+                _mtb_hal_spi_queue_complete(obj, status);
+            }
+        }
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    if ((CY_RSLT_SUCCESS == result) && desc->complete)
+    {
+        /* Transfer could not be started */
+        result = desc->result;
+    }
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_queue_get_count
+//--------------------------------------------------------------------------------------------------
+uint32_t mtb_hal_spi_queue_get_count(mtb_hal_spi_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->queue.count;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// mtb_hal_spi_queue_stop
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t mtb_hal_spi_queue_stop(mtb_hal_spi_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    _mtb_hal_spi_queue_t* queue = &(obj->queue);
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    if (0U != queue->count)
+    {
+        #if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+        if (obj->is_dma)
+        {
+            (void)mtb_hal_dma_disable(obj->dma_tx);
+            (void)mtb_hal_dma_disable(obj->dma_rx);
+            obj->is_dma = false;
+            mtb_hal_spi_clear(obj);
+        }
+        else
+        #endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+        {
+            Cy_SCB_SPI_AbortTransfer(obj->base, obj->context);
+        }
+        obj->pending = _MTB_HAL_SPI_PENDING_NONE;
+        obj->is_async = false;
+    }
+    /* Detach the queue so that no further transfer is started while retiring the pending ones */
+    mtb_hal_spi_xfer_desc_t** storage = queue->storage;
+    uint8_t size = queue->size;
+    uint8_t head = queue->head;
+    uint8_t count = queue->count;
+    queue->storage = NULL;
+    queue->count = 0U;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        mtb_hal_spi_xfer_desc_t* done = storage[(head + i) % size];
+        done->result = MTB_HAL_SPI_RSLT_ABORTED;
+        done->complete = true;
+        if (NULL != done->callback)
+        {
+            done->callback(done->callback_arg, done);
+        }
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // mtb_hal_spi_clear
 //--------------------------------------------------------------------------------------------------
@@ -517,19 +1477,29 @@ void mtb_hal_spi_enable_event(mtb_hal_spi_t* obj, mtb_hal_spi_event_t event, boo
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_spi_cb_wrapper
 //--------------------------------------------------------------------------------------------------
-static void _mtb_hal_spi_cb_wrapper(uint32_t event)
+/* Called by the PDL from within Cy_SCB_SPI_Interrupt. The events are delivered to the user
+   once the interrupt pass completes. */
+static void _mtb_hal_spi_cb_wrapper(void* obj, uint32_t event)
+{
+    ((mtb_hal_spi_t*)obj)->pending_events |= event;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_spi_deliver_events
+//--------------------------------------------------------------------------------------------------
+static void _mtb_hal_spi_deliver_events(mtb_hal_spi_t* obj)
 {
-    /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in
-       here, they
-     * just might change where the original pointer points */
-    mtb_hal_spi_t* obj = (mtb_hal_spi_t*)_mtb_hal_spi_irq_obj;
-    mtb_hal_spi_event_t anded_events = (mtb_hal_spi_event_t)(obj->irq_cause & ((uint32_t)event));
+    mtb_hal_spi_event_t anded_events =
+        (mtb_hal_spi_event_t)(obj->irq_cause & obj->pending_events);
+    obj->pending_events = 0U;
 
     // Don't call the callback until the final transfer has put everything in the FIFO/completed
-    if ((anded_events & (MTB_HAL_SPI_IRQ_DATA_IN_FIFO | MTB_HAL_SPI_IRQ_DONE)) &&
-        !((obj->rx_buffer == NULL) && (obj->tx_buffer == NULL)))
+    if (!((obj->rx_buffer == NULL) && (obj->tx_buffer == NULL)))
     {
-        return;
+        anded_events = (mtb_hal_spi_event_t)((uint32_t)anded_events &
+                                             ~(uint32_t)(MTB_HAL_SPI_IRQ_DATA_IN_FIFO |
+                                                         MTB_HAL_SPI_IRQ_DONE));
     }
 
     if (anded_events)
@@ -551,7 +1521,9 @@ void mtb_hal_spi_register_callback(mtb_hal_spi_t* obj, mtb_hal_spi_event_callbac
     obj->callback_data.callback = (cy_israddress)callback;
     obj->callback_data.callback_arg = callback_arg;
     mtb_hal_system_critical_section_exit(savedIntrStatus);
-    Cy_SCB_SPI_RegisterCallback(obj->base, _mtb_hal_spi_cb_wrapper, obj->context);
+    Cy_SCB_SPI_RegisterCallback(obj->base,
+                                _mtb_hal_scb_bind_event(obj->base, obj, _mtb_hal_spi_cb_wrapper),
+                                obj->context);
 }
 
 
@@ -560,33 +1532,39 @@ void mtb_hal_spi_register_callback(mtb_hal_spi_t* obj, mtb_hal_spi_event_callbac
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t mtb_hal_spi_process_interrupt(mtb_hal_spi_t* spi)
 {
-    /* Save the old value and store it aftewards in case we get into a nested IRQ situation */
-    /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in
-       here, they
-     * just might change where the original pointer points */
-    mtb_hal_spi_t* old_irq_obj = (mtb_hal_spi_t*)_mtb_hal_spi_irq_obj;
-
     if (NULL == spi)
     {
         return MTB_HAL_SPI_RSLT_BAD_ARGUMENT;  /* The interrupt object is not valid */
     }
 
-    _mtb_hal_spi_irq_obj = spi;
-
     Cy_SCB_SPI_Interrupt(spi->base, (spi->context));
 
+    bool finished = false;
+    uint32_t status = 0U;
     if (spi->is_async)
     {
-        if (0 ==
-            (Cy_SCB_SPI_GetTransferStatus(spi->base, spi->context) & CY_SCB_SPI_TRANSFER_ACTIVE))
+        status = Cy_SCB_SPI_GetTransferStatus(spi->base, spi->context);
+        if (0 == (status & CY_SCB_SPI_TRANSFER_ACTIVE))
         {
-            /* Finish Async Transfer */
-            spi->pending = _MTB_HAL_SPI_PENDING_NONE;
+            /* Finish Async Transfer before the events are delivered, so that the callback can
+               start the next one */
             spi->is_async = false;
+            _mtb_hal_spi_xfer_done(spi);
+            finished = true;
         }
     }
 
-    _mtb_hal_spi_irq_obj = old_irq_obj;
+    if (0U != spi->pending_events)
+    {
+        _mtb_hal_spi_deliver_events(spi);
+    }
+
+    if (finished && (0U != spi->queue.count))
+    {
+        _mtb_hal_spi_queue_complete(spi, (0U != (status & _MTB_HAL_SPI_TRANSFER_ERRORS))
+            ? MTB_HAL_SPI_RSLT_TRANSFER_ERROR
+            : CY_RSLT_SUCCESS);
+    }
 
     return CY_RSLT_SUCCESS;
 }
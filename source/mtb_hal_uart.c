@@ -33,6 +33,7 @@
 #include "mtb_hal_system_impl.h"
 #include "mtb_hal_utils.h"
 #include "mtb_hal_irq_impl.h"
+#include "mtb_hal_scb_common.h"
 #if (MTB_HAL_DRIVER_AVAILABLE_DMA)
 #include "mtb_hal_dma.h"
 #endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA */
@@ -49,6 +50,11 @@
  * and from the FIFOs. The purpose of this is to minimize CPU load on
  * large transfers.
  *
+ * \section group_hal_uart_dma_ring Continuous DMA Reception
+ * \ref mtb_hal_uart_rx_ring_start runs a DMA channel endlessly over a power-of-two ring buffer.
+ * Unlike \ref mtb_hal_uart_read_async, the transfer is never re-armed, so no bytes are lost
+ * between transfers at high baud rates. Received data is consumed in place.
+ *
  * \section group_hal_uart_pm_strategy UART at different power modes
  * In order to allow UART to maintain the specified baud rate in all
  * power modes as the clock inputs can change when switching power modes,
@@ -71,13 +77,18 @@ extern "C"
 
 
 /*******************************************************************************
-*                           Private Variables
+*                           Private Typedefs
 *******************************************************************************/
 
-/* Keep track of the current UART object to ensure we are referencing the
- * correct one, as we don't directly pass the object through the PDL callback
- * indirection.  This also protects against a nested callback situation. */
-static volatile mtb_hal_uart_t* _mtb_hal_uart_irq_obj = NULL;
+/* Pin functions saved while the UART is disabled for a baud rate change */
+typedef struct
+{
+    en_hsiom_sel_t tx_hsiom;
+    #if defined(COMPONENT_MW_ASYNC_TRANSFER)
+    en_hsiom_sel_t rts_hsiom;
+    #endif
+} _mtb_hal_uart_pin_hold_t;
+
 
 /*******************************************************************************
 *                       Private Function Definitions
@@ -91,24 +102,92 @@ __STATIC_INLINE uint32_t _mtb_hal_uart_get_mode(CySCB_Type const* base)
 }
 
 
+/** Sets the UART's oversample factor. The UART must be disabled. */
+__STATIC_INLINE void _mtb_hal_uart_set_oversample(CySCB_Type* base, uint32_t oversample)
+{
+    SCB_CTRL(base) = _CLR_SET_FLD32U(SCB_CTRL(base), SCB_CTRL_OVS, oversample - 1UL);
+}
+
+
+/** Returns the RX FIFO trigger level */
+__STATIC_INLINE uint32_t _mtb_hal_uart_get_rx_fifo_level(CySCB_Type const* base)
+{
+    return _FLD2VAL(SCB_RX_FIFO_CTRL_TRIGGER_LEVEL, SCB_RX_FIFO_CTRL(base));
+}
+
+
+/** Returns the TX FIFO trigger level */
+__STATIC_INLINE uint32_t _mtb_hal_uart_get_tx_fifo_level(CySCB_Type const* base)
+{
+    return _FLD2VAL(SCB_TX_FIFO_CTRL_TRIGGER_LEVEL, SCB_TX_FIFO_CTRL(base));
+}
+
+
+/** Disables the UART for a baud rate change, holding its output pins high */
+static void _mtb_hal_uart_baud_change_begin(mtb_hal_uart_t* obj, _mtb_hal_uart_pin_hold_t* hold)
+{
+    // The output pins need to be set to high before going to deepsleep.
+    // Otherwise the UART on the other side would see incoming data as '0'.
+    if (NULL != obj->tx_pin.port)
+    {
+        hold->tx_hsiom = Cy_GPIO_GetHSIOM(obj->tx_pin.port, obj->tx_pin.pinNum);
+        Cy_GPIO_Set(obj->tx_pin.port, obj->tx_pin.pinNum);
+        Cy_GPIO_SetHSIOM(obj->tx_pin.port, obj->tx_pin.pinNum, HSIOM_SEL_GPIO);
+    }
+    #if defined(COMPONENT_MW_ASYNC_TRANSFER)
+    if (NULL != obj->rts_pin.port)
+    {
+        hold->rts_hsiom = Cy_GPIO_GetHSIOM(obj->rts_pin.port, obj->rts_pin.pinNum);
+        Cy_GPIO_Set(obj->rts_pin.port, obj->rts_pin.pinNum);
+        Cy_GPIO_SetHSIOM(obj->rts_pin.port, obj->rts_pin.pinNum, HSIOM_SEL_GPIO);
+    }
+    #endif
+
+    Cy_SCB_UART_Disable(obj->base, NULL);
+}
+
+
+/** Re-enables the UART after a baud rate change and restores its pins */
+static void _mtb_hal_uart_baud_change_end(mtb_hal_uart_t* obj, const _mtb_hal_uart_pin_hold_t* hold)
+{
+    //Restore the pins fuctionality
+    if (NULL != obj->tx_pin.port)
+    {
+        Cy_GPIO_SetHSIOM(obj->tx_pin.port, obj->tx_pin.pinNum, hold->tx_hsiom);
+    }
+    #if defined(COMPONENT_MW_ASYNC_TRANSFER)
+    if (NULL != obj->rts_pin.port)
+    {
+        Cy_GPIO_SetHSIOM(obj->rts_pin.port, obj->rts_pin.pinNum, hold->rts_hsiom);
+    }
+    #endif
+
+    Cy_SCB_UART_Enable(obj->base);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_uart_irq_handler
 //--------------------------------------------------------------------------------------------------
 static void _mtb_hal_uart_irq_handler(mtb_hal_uart_t* obj)
 {
-    /* Save the old value and store it aftewards in case we get into a nested IRQ situation */
-    /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in
-       here, they
-     * just might change where the original pointer points */
-    mtb_hal_uart_t* old_irq_obj = (mtb_hal_uart_t*)_mtb_hal_uart_irq_obj;
-
     CY_ASSERT(NULL != obj);
 
-    _mtb_hal_uart_irq_obj = obj;
-
     /* Cy_SCB_UART_Interrupt() manipulates the interrupt masks. Save a copy to work around it. */
     uint32_t txMasked = Cy_SCB_GetTxInterruptStatusMasked(obj->base);
     uint32_t rxMasked = Cy_SCB_GetRxInterruptStatusMasked(obj->base);
+    _MTB_HAL_PERF_ISR_ENTER(MTB_HAL_RSLT_MODULE_UART, obj, (txMasked << 16U) | rxMasked);
+    #if defined(MTB_HAL_PERF_ENABLE)
+    uint32_t errors = (txMasked & (CY_SCB_UART_TX_OVERFLOW | CY_SCB_UART_TX_UNDERFLOW)) |
+                      (rxMasked & (CY_SCB_RX_INTR_OVERFLOW | CY_SCB_RX_INTR_UNDERFLOW |
+                                   CY_SCB_RX_INTR_UART_FRAME_ERROR |
+                                   CY_SCB_RX_INTR_UART_PARITY_ERROR));
+    if (0UL != errors)
+    {
+        ++obj->perf.errors;
+        _MTB_HAL_PERF_TRACE(MTB_HAL_RSLT_MODULE_UART, MTB_HAL_PERF_EVENT_ERROR, obj, errors);
+    }
+    #endif // defined(MTB_HAL_PERF_ENABLE)
 
     /* SCB high-level API interrupt handler. Must be called as high-level API is used in the HAL */
     Cy_SCB_UART_Interrupt(obj->base, obj->context);
@@ -120,11 +199,7 @@ static void _mtb_hal_uart_irq_handler(mtb_hal_uart_t* obj)
     if (0UL != (CY_SCB_UART_TX_OVERFLOW & txMasked))
     {
         Cy_SCB_ClearTxInterrupt(obj->base, CY_SCB_UART_TX_OVERFLOW);
-
-        if (NULL != obj->context->cbEvents)
-        {
-            obj->context->cbEvents(CY_SCB_UART_TRANSMIT_ERR_EVENT);
-        }
+        obj->pending_events |= CY_SCB_UART_TRANSMIT_ERR_EVENT;
     }
 
     /* Custom handling for TX underflow (cannot occur using HAL API but can occur if user makes
@@ -134,11 +209,7 @@ static void _mtb_hal_uart_irq_handler(mtb_hal_uart_t* obj)
     if (0UL != (CY_SCB_UART_TX_UNDERFLOW & txMasked))
     {
         Cy_SCB_ClearTxInterrupt(obj->base, CY_SCB_UART_TX_UNDERFLOW);
-
-        if (NULL != obj->context->cbEvents)
-        {
-            obj->context->cbEvents(CY_SCB_UART_TRANSMIT_ERR_EVENT);
-        }
+        obj->pending_events |= CY_SCB_UART_TRANSMIT_ERR_EVENT;
     }
 
     /* Custom handling for TX FIFO trigger.
@@ -146,10 +217,7 @@ static void _mtb_hal_uart_irq_handler(mtb_hal_uart_t* obj)
         when processing CY_SCB_TX_INTR_LEVEL. Do not clear the interrupt. */
     if (0UL != (CY_SCB_UART_TX_TRIGGER & txMasked))
     {
-        if (NULL != obj->context->cbEvents)
-        {
-            obj->context->cbEvents((uint32_t)MTB_HAL_UART_IRQ_TX_FIFO);
-        }
+        obj->pending_events |= (uint32_t)MTB_HAL_UART_IRQ_TX_FIFO;
     }
 
     /* Manually clear the tx done interrupt and re-enable the interrupt mask */
@@ -167,11 +235,7 @@ static void _mtb_hal_uart_irq_handler(mtb_hal_uart_t* obj)
     if (0UL != (CY_SCB_RX_INTR_UNDERFLOW & rxMasked))
     {
         Cy_SCB_ClearRxInterrupt(obj->base, CY_SCB_RX_INTR_UNDERFLOW);
-
-        if (NULL != obj->context->cbEvents)
-        {
-            obj->context->cbEvents(CY_SCB_UART_RECEIVE_ERR_EVENT);
-        }
+        obj->pending_events |= CY_SCB_UART_RECEIVE_ERR_EVENT;
     }
 
     /* Custom handling for RX FIFO trigger
@@ -179,12 +243,116 @@ static void _mtb_hal_uart_irq_handler(mtb_hal_uart_t* obj)
         when processing CY_SCB_RX_INTR_LEVEL. Do not clear the interrupt. */
     if (0UL != (CY_SCB_UART_RX_TRIGGER & rxMasked))
     {
-        if (NULL != obj->context->cbEvents)
+        obj->pending_events |= (uint32_t)MTB_HAL_UART_IRQ_RX_FIFO;
+    }
+
+    /* Deliver everything raised during this pass in a single callback */
+    mtb_hal_uart_event_t anded_events = (mtb_hal_uart_event_t)(obj->irq_cause &
+                                                               obj->pending_events);
+    obj->pending_events = 0U;
+    if (anded_events)
+    {
+        mtb_hal_uart_event_callback_t callback =
+            (mtb_hal_uart_event_callback_t)obj->callback_data.callback;
+        if (NULL != callback)
+        {
+            callback(obj->callback_data.callback_arg, anded_events);
+        }
+    }
+    _MTB_HAL_PERF_ISR_EXIT(MTB_HAL_RSLT_MODULE_UART, obj);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_uart_raw_irq_handler
+//--------------------------------------------------------------------------------------------------
+/* Raw FIFO mode interrupt handler. Moves data between the FIFOs and the rings without going
+   through Cy_SCB_UART_Interrupt, so none of the PDL context bookkeeping is paid per byte. */
+static void _mtb_hal_uart_raw_irq_handler(mtb_hal_uart_t* obj)
+{
+    _mtb_hal_uart_raw_t* raw = &obj->raw;
+    CySCB_Type* base = obj->base;
+    uint32_t events = 0U;
+
+    uint32_t rxMasked = Cy_SCB_GetRxInterruptStatusMasked(base);
+    uint32_t txMasked = Cy_SCB_GetTxInterruptStatusMasked(base);
+    _MTB_HAL_PERF_ISR_ENTER(MTB_HAL_RSLT_MODULE_UART, obj, (txMasked << 16U) | rxMasked);
+
+    if (0UL != (CY_SCB_RX_INTR_LEVEL & rxMasked))
+    {
+        uint32_t head = raw->rx_head;
+        uint32_t tail = raw->rx_tail;
+        uint32_t count = Cy_SCB_GetNumInRxFifo(base);
+        uint32_t received = 0U;
+
+        while (count > 0U)
+        {
+            uint8_t data = (uint8_t)Cy_SCB_ReadRxFifo(base);
+            if ((head - tail) <= raw->rx_mask)
+            {
+                raw->rx_buffer[head & raw->rx_mask] = data;
+                ++head;
+                ++received;
+            }
+            else
+            {
+                ++raw->rx_dropped;
+                events |= (uint32_t)MTB_HAL_UART_IRQ_RX_FULL;
+            }
+            --count;
+        }
+        raw->rx_head = head;
+        /* The level interrupt stays asserted until the FIFO has been drained below the level */
+        Cy_SCB_ClearRxInterrupt(base, CY_SCB_RX_INTR_LEVEL);
+        if (0U != received)
+        {
+            events |= (uint32_t)MTB_HAL_UART_IRQ_RX_FIFO;
+            _MTB_HAL_PERF_ADD(obj, bytes, received);
+        }
+    }
+
+    if (0UL != (CY_SCB_UART_RECEIVE_ERR & rxMasked))
+    {
+        Cy_SCB_ClearRxInterrupt(base, CY_SCB_UART_RECEIVE_ERR & rxMasked);
+        events |= (uint32_t)MTB_HAL_UART_IRQ_RX_ERROR;
+        _MTB_HAL_PERF_ADD(obj, errors, 1U);
+    }
+
+    if (0UL != (CY_SCB_TX_INTR_LEVEL & txMasked))
+    {
+        uint32_t head = raw->tx_head;
+        uint32_t tail = raw->tx_tail;
+        uint32_t space = Cy_SCB_GetFifoSize(base) - Cy_SCB_GetNumInTxFifo(base);
+
+        _MTB_HAL_PERF_ADD(obj, bytes, (space < (head - tail)) ? space : (head - tail));
+        while ((space > 0U) && (tail != head))
+        {
+            Cy_SCB_WriteTxFifo(base, raw->tx_buffer[tail & raw->tx_mask]);
+            ++tail;
+            --space;
+        }
+        raw->tx_tail = tail;
+        if (tail == head)
         {
-            obj->context->cbEvents((uint32_t)MTB_HAL_UART_IRQ_RX_FIFO);
+            /* Nothing more to send; mask the level interrupt until the next write */
+            Cy_SCB_SetTxInterruptMask(base,
+                                      Cy_SCB_GetTxInterruptMask(base) & ~CY_SCB_TX_INTR_LEVEL);
+            events |= (uint32_t)MTB_HAL_UART_IRQ_TX_TRANSMIT_IN_FIFO;
         }
+        Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_LEVEL);
     }
-    _mtb_hal_uart_irq_obj = old_irq_obj;
+
+    mtb_hal_uart_event_t anded_events = (mtb_hal_uart_event_t)(obj->irq_cause & events);
+    if (anded_events)
+    {
+        mtb_hal_uart_event_callback_t callback =
+            (mtb_hal_uart_event_callback_t)obj->callback_data.callback;
+        if (NULL != callback)
+        {
+            callback(obj->callback_data.callback_arg, anded_events);
+        }
+    }
+    _MTB_HAL_PERF_ISR_EXIT(MTB_HAL_RSLT_MODULE_UART, obj);
 }
 
 
@@ -227,24 +395,12 @@ static CY_SCB_IRQ_THREAD_CB_t _mtb_hal_irq_cb[3] =
 //--------------------------------------------------------------------------------------------------
 // _mtb_hal_uart_cb_wrapper
 //--------------------------------------------------------------------------------------------------
-static void _mtb_hal_uart_cb_wrapper(uint32_t event)
+/* Called by the PDL from within Cy_SCB_UART_Interrupt. The events are delivered to the user
+   once the interrupt pass completes. */
+static void _mtb_hal_uart_cb_wrapper(void* obj, uint32_t event)
 {
-    /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in
-       here, they
-     * just might change where the original pointer points */
-    mtb_hal_uart_t* obj = (mtb_hal_uart_t*)_mtb_hal_uart_irq_obj;
     CY_ASSERT(NULL != obj);
-    mtb_hal_uart_event_t anded_events = (mtb_hal_uart_event_t)(obj->irq_cause & event);
-
-    if (anded_events)
-    {
-        mtb_hal_uart_event_callback_t callback =
-            (mtb_hal_uart_event_callback_t)obj->callback_data.callback;
-        if (NULL != callback)
-        {
-            callback(obj->callback_data.callback_arg, anded_events);
-        }
-    }
+    ((mtb_hal_uart_t*)obj)->pending_events |= event;
 }
 
 
@@ -257,6 +413,67 @@ __STATIC_INLINE bool _mtb_hal_uart_is_busy(mtb_hal_uart_t* obj)
 
 #if defined(COMPONENT_MW_ASYNC_TRANSFER)
 
+/** Program the RX trigger level from the requested and the tuned level */
+static void _mtb_hal_uart_fifo_adapt_apply_rx(mtb_hal_uart_t* obj)
+{
+    _mtb_hal_uart_fifo_adapt_t* adapt = &obj->fifo_adapt;
+    adapt->rx_applied = adapt->enabled
+        ? (uint16_t)_MTB_HAL_MIN(adapt->rx_level, adapt->rx_requested)
+        : adapt->rx_requested;
+    Cy_SCB_SetRxFifoLevel(obj->base, adapt->rx_applied);
+}
+
+
+/** Tune the RX level after servicing a level interrupt that found `count` bytes in the FIFO */
+static void _mtb_hal_uart_fifo_adapt_rx(mtb_hal_uart_t* obj, uint32_t count)
+{
+    _mtb_hal_uart_fifo_adapt_t* adapt = &obj->fifo_adapt;
+    uint32_t fifo_size = Cy_SCB_GetFifoSize(obj->base);
+    /* Bytes beyond the trigger point arrived during interrupt latency. Keep twice that much
+       room above the level so a burst at the same rate does not overflow the FIFO. */
+    uint32_t latency_bytes = (count > ((uint32_t)adapt->rx_applied + 1u))
+        ? (count - adapt->rx_applied - 1u) : 1u;
+    uint32_t cap = ((fifo_size * 3u) / 4u > (2u * latency_bytes))
+        ? ((fifo_size * 3u) / 4u - (2u * latency_bytes)) : 0u;
+    uint32_t level = _MTB_HAL_MIN((2u * adapt->rx_level) + 1u, cap);
+
+    /* Only a full read proves the rate; a level already lowered for the end of a read says
+       nothing about it */
+    if ((adapt->rx_applied == adapt->rx_level) && (level != adapt->rx_level))
+    {
+        adapt->rx_level = (uint16_t)level;
+        ++adapt->level_changes;
+    }
+}
+
+
+/** Tune the TX level after servicing a level interrupt that found `count` bytes in the FIFO */
+static void _mtb_hal_uart_fifo_adapt_tx(mtb_hal_uart_t* obj, uint32_t count)
+{
+    _mtb_hal_uart_fifo_adapt_t* adapt = &obj->fifo_adapt;
+    uint32_t fifo_size = Cy_SCB_GetFifoSize(obj->base);
+    uint32_t level;
+
+    if (0u == count)
+    {
+        /* The line may have gone idle before the refill; refill earlier */
+        ++adapt->tx_underruns;
+        level = _MTB_HAL_MIN(2u * adapt->tx_level, fifo_size / 2u);
+    }
+    else
+    {
+        /* Data was still queued; refill later to move more bytes per interrupt */
+        level = (adapt->tx_level > 1u) ? (adapt->tx_level - 1u) : 1u;
+    }
+    if (adapt->enabled && (level != adapt->tx_level))
+    {
+        adapt->tx_level = (uint16_t)level;
+        ++adapt->level_changes;
+        Cy_SCB_SetTxFifoLevel(obj->base, level);
+    }
+}
+
+
 /** Handles the UART async transfer Invokes the fifo level event processing functions */
 cy_rslt_t _mtb_hal_uart_async_transfer_handler(void* obj)
 {
@@ -268,22 +485,54 @@ cy_rslt_t _mtb_hal_uart_async_transfer_handler(void* obj)
 
     uint32_t txMasked = Cy_SCB_GetTxInterruptStatusMasked(uart_obj->base);
     uint32_t rxMasked = Cy_SCB_GetRxInterruptStatusMasked(uart_obj->base);
+    uint32_t rx_before = 0u;
+    uint32_t tx_before = 0u;
 
     /* RX FIFO level event  */
     if (0u != (CY_SCB_UART_RX_TRIGGER & rxMasked))
     {
         direction = MTB_ASYNC_TRANSFER_DIRECTION_READ;
+        rx_before = Cy_SCB_UART_GetNumInRxFifo(uart_obj->base);
     }
     /* TX FIFO level event  */
     if (0u != (CY_SCB_UART_TX_TRIGGER & txMasked))
     {
         direction |= MTB_ASYNC_TRANSFER_DIRECTION_WRITE;
+        tx_before = Cy_SCB_UART_GetNumInTxFifo(uart_obj->base);
     }
     if (direction)
     {
+        _mtb_hal_uart_fifo_adapt_t* adapt = &uart_obj->fifo_adapt;
+        if (0u != (direction & MTB_ASYNC_TRANSFER_DIRECTION_READ))
+        {
+            ++adapt->rx_interrupts;
+            if (adapt->enabled)
+            {
+                _mtb_hal_uart_fifo_adapt_rx(uart_obj, rx_before);
+            }
+        }
+        if (0u != (direction & MTB_ASYNC_TRANSFER_DIRECTION_WRITE))
+        {
+            ++adapt->tx_interrupts;
+            _mtb_hal_uart_fifo_adapt_tx(uart_obj, tx_before);
+        }
+
         result =
             mtb_async_transfer_process_fifo_level_event(uart_obj->async_ctx,
                                                         (mtb_async_transfer_direction_t)direction);
+
+        /* The FIFO may have moved on the line side meanwhile; never count a negative transfer */
+        if (0u != (direction & MTB_ASYNC_TRANSFER_DIRECTION_READ))
+        {
+            uint32_t rx_after = Cy_SCB_UART_GetNumInRxFifo(uart_obj->base);
+            adapt->rx_bytes += (rx_before > rx_after) ? (rx_before - rx_after) : 0u;
+            adapt->rx_last_count = 0u;
+        }
+        if (0u != (direction & MTB_ASYNC_TRANSFER_DIRECTION_WRITE))
+        {
+            uint32_t tx_after = Cy_SCB_UART_GetNumInTxFifo(uart_obj->base);
+            adapt->tx_bytes += (tx_after > tx_before) ? (tx_after - tx_before) : 0u;
+        }
     }
     return result;
 }
@@ -362,7 +611,11 @@ uint32_t _mtb_hal_uart_async_transfer_get_tx_transfer_len(void* inst_ref)
    FIFO than this level, the RX level interrupt is triggered */
 void _mtb_hal_uart_async_transfer_set_rx_fifo_level(void* inst_ref, uint32_t level)
 {
-    Cy_SCB_SetRxFifoLevel(((mtb_hal_uart_t*)inst_ref)->base, level);
+    mtb_hal_uart_t* obj = (mtb_hal_uart_t*)inst_ref;
+    /* The requested level reflects the remaining length of the read; the tuned level may only
+       lower it */
+    obj->fifo_adapt.rx_requested = (uint16_t)level;
+    _mtb_hal_uart_fifo_adapt_apply_rx(obj);
 }
 
 
@@ -370,7 +623,9 @@ void _mtb_hal_uart_async_transfer_set_rx_fifo_level(void* inst_ref, uint32_t lev
    FIFO than this level, the TX level interrupt is triggered */
 void _mtb_hal_uart_async_transfer_set_tx_fifo_level(void* inst_ref, uint32_t level)
 {
-    Cy_SCB_SetTxFifoLevel(((mtb_hal_uart_t*)inst_ref)->base, level);
+    mtb_hal_uart_t* obj = (mtb_hal_uart_t*)inst_ref;
+    Cy_SCB_SetTxFifoLevel(obj->base,
+                          obj->fifo_adapt.enabled ? (uint32_t)obj->fifo_adapt.tx_level : level);
 }
 
 
@@ -418,6 +673,8 @@ cy_rslt_t _mtb_hal_uart_config_async_common(mtb_hal_uart_t* obj,
     interface->enter_critical_section = Cy_SysLib_EnterCriticalSection;
     interface->exit_critical_section = Cy_SysLib_ExitCriticalSection;
     obj->async_ctx = context;
+    obj->fifo_adapt.enabled = false;
+    obj->fifo_adapt.dma = false;
 
     return CY_RSLT_SUCCESS;
 }
@@ -470,6 +727,11 @@ void _mtb_hal_uart_async_transfer_event_callback(void* callback_arg,
 void _mtb_hal_uart_async_transfer_enable_dma(void* inst_ref, bool enable)
 {
     CY_ASSERT(NULL != inst_ref);
+    if (enable)
+    {
+        /* The address and length hooks only write the descriptor; publish it once here */
+        _mtb_hal_dma_clean_descriptor((mtb_hal_dma_t*)inst_ref);
+    }
     mtb_hal_dma_enable_event((mtb_hal_dma_t*)inst_ref,
                              MTB_HAL_DMA_DESCRIPTOR_COMPLETE,
                              enable);
@@ -508,7 +770,7 @@ void _mtb_hal_uart_tx_dma_event_callback(void* callback_arg, mtb_hal_dma_event_t
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t _mtb_hal_uart_dma_set_src_addr(void* dma_ref, void* addr)
 {
-    return mtb_hal_dma_set_src_addr((mtb_hal_dma_t*)dma_ref, (uint32_t)addr);
+    return _mtb_hal_dma_set_src_addr((mtb_hal_dma_t*)dma_ref, (uint32_t)addr, false);
 }
 
 
@@ -517,13 +779,89 @@ cy_rslt_t _mtb_hal_uart_dma_set_src_addr(void* dma_ref, void* addr)
 //--------------------------------------------------------------------------------------------------
 cy_rslt_t _mtb_hal_uart_dma_set_dst_addr(void* dma_ref, void* addr)
 {
-    return mtb_hal_dma_set_dst_addr((mtb_hal_dma_t*)dma_ref, (uint32_t)addr);
+    return _mtb_hal_dma_set_dst_addr((mtb_hal_dma_t*)dma_ref, (uint32_t)addr, false);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// _mtb_hal_uart_dma_set_length
+//--------------------------------------------------------------------------------------------------
+cy_rslt_t _mtb_hal_uart_dma_set_length(void* dma_ref, uint32_t length)
+{
+    return _mtb_hal_dma_set_length((mtb_hal_dma_t*)dma_ref, length, false);
 }
 
 
 #endif // (MTB_HAL_DRIVER_AVAILABLE_DMA)
 #endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
 
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+
+/** Returns the free-running write index of the RX ring */
+static uint32_t _mtb_hal_uart_rx_ring_get_head(mtb_hal_uart_t* obj)
+{
+    _mtb_hal_uart_rx_ring_t* ring = &obj->rx_ring;
+    uint32_t head = (ring->laps * ring->size) + mtb_hal_dma_get_transfer_index(ring->dma);
+    /* The DMA may have wrapped around before its interrupt updated the lap count */
+    if ((int32_t)(head - ring->tail) < 0)
+    {
+        head += ring->size;
+    }
+    return head;
+}
+
+
+/** Invokes the user callback for the enabled subset of the given events */
+static void _mtb_hal_uart_rx_ring_notify(mtb_hal_uart_t* obj, uint32_t event)
+{
+    mtb_hal_uart_event_t anded_events = (mtb_hal_uart_event_t)(obj->irq_cause & event);
+    if (anded_events)
+    {
+        mtb_hal_uart_event_callback_t callback =
+            (mtb_hal_uart_event_callback_t)obj->callback_data.callback;
+        if (NULL != callback)
+        {
+            callback(obj->callback_data.callback_arg, anded_events);
+        }
+    }
+}
+
+
+/** RX ring DMA event callback */
+static void _mtb_hal_uart_rx_ring_dma_event_callback(void* callback_arg, mtb_hal_dma_event_t event)
+{
+    mtb_hal_uart_t* obj = (mtb_hal_uart_t*)callback_arg;
+    CY_ASSERT(NULL != obj);
+    _mtb_hal_uart_rx_ring_t* ring = &obj->rx_ring;
+    uint32_t hal_event = MTB_HAL_UART_IRQ_NONE;
+
+    if (0u != (event & MTB_HAL_DMA_DESCRIPTOR_COMPLETE))
+    {
+        ring->laps++;
+        ring->half_reported = false;
+        hal_event |= MTB_HAL_UART_IRQ_RX_RING_FULL;
+    }
+    else if ((0u != (event & MTB_HAL_DMA_TRANSFER_COMPLETE)) && !ring->half_reported &&
+             (mtb_hal_dma_get_transfer_index(ring->dma) >= (ring->size / 2)))
+    {
+        ring->half_reported = true;
+        hal_event |= MTB_HAL_UART_IRQ_RX_RING_HALF;
+    }
+
+    uint32_t head = _mtb_hal_uart_rx_ring_get_head(obj);
+    if ((head - ring->tail) > ring->size)
+    {
+        /* Unread data was overwritten. Skip to the current write position. */
+        ring->tail = head;
+        hal_event |= MTB_HAL_UART_IRQ_RX_RING_OVERFLOW;
+    }
+
+    _mtb_hal_uart_rx_ring_notify(obj, hal_event);
+}
+
+
+#endif // (MTB_HAL_DRIVER_AVAILABLE_DMA)
+
 /*******************************************************************************
 *                        Public Function Definitions
 *******************************************************************************/
@@ -580,10 +918,7 @@ cy_rslt_t mtb_hal_uart_set_baud(mtb_hal_uart_t* obj, uint32_t baudrate, uint32_t
     uint32_t  actual_freq;
     uint32_t  tolerance;
     uint32_t  oversample;
-    en_hsiom_sel_t  tx_hsiom = (en_hsiom_sel_t)0U;
-    #if defined(COMPONENT_MW_ASYNC_TRANSFER)
-    en_hsiom_sel_t  rts_hsiom = (en_hsiom_sel_t)0U;
-    #endif
+    _mtb_hal_uart_pin_hold_t hold;
 
     #if defined(MTB_HAL_DISABLE_ERR_CHECK)
     CY_ASSERT_AND_RETURN((!_mtb_hal_uart_is_busy(obj)), MTB_HAL_UART_RSLT_ERR_BUSY);
@@ -594,24 +929,24 @@ cy_rslt_t mtb_hal_uart_set_baud(mtb_hal_uart_t* obj, uint32_t baudrate, uint32_t
     }
     #endif
 
-    // The output pins need to be set to high before going to deepsleep.
-    // Otherwise the UART on the other side would see incoming data as '0'.
-    if (NULL != obj->tx_pin.port)
+    if (&mtb_hal_clock_peri_interface == obj->clock->interface)
     {
-        tx_hsiom = Cy_GPIO_GetHSIOM(obj->tx_pin.port, obj->tx_pin.pinNum);
-        Cy_GPIO_Set(obj->tx_pin.port, obj->tx_pin.pinNum);
-        Cy_GPIO_SetHSIOM(obj->tx_pin.port, obj->tx_pin.pinNum, HSIOM_SEL_GPIO);
-    }
-    #if defined(COMPONENT_MW_ASYNC_TRANSFER)
-    if (NULL != obj->rts_pin.port)
-    {
-        rts_hsiom = Cy_GPIO_GetHSIOM(obj->rts_pin.port, obj->rts_pin.pinNum);
-        Cy_GPIO_Set(obj->rts_pin.port, obj->rts_pin.pinNum);
-        Cy_GPIO_SetHSIOM(obj->rts_pin.port, obj->rts_pin.pinNum, HSIOM_SEL_GPIO);
+        /* Search the oversample factor together with the divider */
+        mtb_hal_uart_baud_config_t config;
+        result = mtb_hal_uart_calc_baud_config(obj, baudrate, &config, actualbaud);
+        if (result == CY_RSLT_SUCCESS)
+        {
+            result = mtb_hal_uart_set_baud_config(obj, &config);
+        }
+        else if (actualbaud != NULL)
+        {
+            *actualbaud = obj->clock->interface->get_frequency_hz(obj->clock->clock_ref) /
+                          Cy_SCB_UART_GetOverSample(obj->base);
+        }
+        return result;
     }
-    #endif
 
-    Cy_SCB_UART_Disable(obj->base, NULL);
+    _mtb_hal_uart_baud_change_begin(obj, &hold);
 
     original_freq = obj->clock->interface->get_frequency_hz(obj->clock->clock_ref);
     oversample = Cy_SCB_UART_GetOverSample(obj->base); /* User-controlled oversample value */
@@ -648,20 +983,127 @@ cy_rslt_t mtb_hal_uart_set_baud(mtb_hal_uart_t* obj, uint32_t baudrate, uint32_t
         *actualbaud = actual_freq/oversample;
     }
 
-    //Restore the pins fuctionality
-    if (NULL != obj->tx_pin.port)
+    _mtb_hal_uart_baud_change_end(obj, &hold);
+    return result;
+}
+
+
+/** Compute the baud rate setting with the smallest error */
+cy_rslt_t mtb_hal_uart_calc_baud_config(mtb_hal_uart_t* obj, uint32_t baudrate,
+                                        mtb_hal_uart_baud_config_t* config, uint32_t* actualbaud)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->base);
+    CY_ASSERT(NULL != config);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN((0u != baudrate), MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT);
+    CY_ASSERT_AND_RETURN((&mtb_hal_clock_peri_interface == obj->clock->interface),
+                         MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION);
+    #else
+    if (0u == baudrate)
     {
-        Cy_GPIO_SetHSIOM(obj->tx_pin.port, obj->tx_pin.pinNum, tx_hsiom);
+        return MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT;
     }
-    #if defined(COMPONENT_MW_ASYNC_TRANSFER)
-    if (NULL != obj->rts_pin.port)
+    if (&mtb_hal_clock_peri_interface != obj->clock->interface)
     {
-        Cy_GPIO_SetHSIOM(obj->rts_pin.port, obj->rts_pin.pinNum, rts_hsiom);
+        return MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
     }
-    #endif
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
 
-    Cy_SCB_UART_Enable(obj->base);
-    return result;
+    const mtb_hal_peri_div_t* div = (const mtb_hal_peri_div_t*)obj->clock->clock_ref;
+    uint32_t source_freq = mtb_hal_clock_get_peri_src_clock_freq(div);
+    uint64_t source_scaled = (uint64_t)source_freq << _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS;
+    uint32_t min_oversample = MTB_HAL_UART_OVERSAMPLE_MIN;
+    uint32_t max_oversample = MTB_HAL_UART_OVERSAMPLE_MAX;
+    uint64_t best_error = UINT64_MAX;
+
+    /* The oversample factor has a different meaning outside of standard mode */
+    if (_mtb_hal_uart_get_mode(obj->base) != CY_SCB_UART_STANDARD)
+    {
+        min_oversample = Cy_SCB_UART_GetOverSample(obj->base);
+        max_oversample = min_oversample;
+    }
+
+    /* Walk down so that ties go to the higher oversample, which samples the bit more robustly */
+    for (uint32_t oversample = max_oversample; oversample >= min_oversample; --oversample)
+    {
+        uint32_t divider;
+        (void)_mtb_hal_clock_calc_peri_div(source_freq, div->div_type, baudrate * oversample,
+                                           &divider);
+        uint64_t ideal = (uint64_t)divider * baudrate * oversample;
+        uint64_t diff = (source_scaled > ideal) ? (source_scaled - ideal) : (ideal - source_scaled);
+        /* Relative error, scaled to PPM */
+        uint64_t error = (diff * 1000000U) / ideal;
+        if (error < best_error)
+        {
+            best_error = error;
+            config->oversample = oversample;
+            config->divider = divider;
+        }
+    }
+
+    if (actualbaud != NULL)
+    {
+        *actualbaud = (uint32_t)((source_scaled + (((uint64_t)config->divider *
+                                                     config->oversample) / 2U)) /
+                                 ((uint64_t)config->divider * config->oversample));
+    }
+    return (best_error > MTB_HAL_UART_CLOCK_FREQ_MAX_TOLERANCE_PPM)
+        ? MTB_HAL_UART_RSLT_ERR_CLOCK_FREQ_TOLERANCE
+        : CY_RSLT_SUCCESS;
+}
+
+
+/** Apply a precomputed baud rate setting */
+cy_rslt_t mtb_hal_uart_set_baud_config(mtb_hal_uart_t* obj,
+                                       const mtb_hal_uart_baud_config_t* config)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->base);
+    CY_ASSERT(NULL != config);
+    _mtb_hal_uart_pin_hold_t hold;
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN((&mtb_hal_clock_peri_interface == obj->clock->interface),
+                         MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION);
+    CY_ASSERT_AND_RETURN(((config->oversample >= MTB_HAL_UART_OVERSAMPLE_MIN) &&
+                          (config->oversample <= MTB_HAL_UART_OVERSAMPLE_MAX) &&
+                          ((config->divider >> _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS) != 0u)),
+                         MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT);
+    CY_ASSERT_AND_RETURN((!_mtb_hal_uart_is_busy(obj)), MTB_HAL_UART_RSLT_ERR_BUSY);
+    #else
+    if (&mtb_hal_clock_peri_interface != obj->clock->interface)
+    {
+        return MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+    if ((config->oversample < MTB_HAL_UART_OVERSAMPLE_MIN) ||
+        (config->oversample > MTB_HAL_UART_OVERSAMPLE_MAX) ||
+        ((config->divider >> _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS) == 0u))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if (_mtb_hal_uart_is_busy(obj))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BUSY;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+
+    const mtb_hal_peri_div_t* div = (const mtb_hal_peri_div_t*)obj->clock->clock_ref;
+    /* An integer divider cannot take a fraction, and other modes keep their oversample factor */
+    if (((div->div_type < CY_SYSCLK_DIV_16_5_BIT) &&
+         (0u != (config->divider & ((1UL << _MTB_HAL_CLOCK_PERI_DIV_FRAC_BITS) - 1u)))) ||
+        ((_mtb_hal_uart_get_mode(obj->base) != CY_SCB_UART_STANDARD) &&
+         (config->oversample != Cy_SCB_UART_GetOverSample(obj->base))))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT;
+    }
+
+    _mtb_hal_uart_baud_change_begin(obj, &hold);
+    _mtb_hal_uart_set_oversample(obj->base, config->oversample);
+    _mtb_hal_clock_set_peri_div(div, config->divider);
+    _mtb_hal_uart_baud_change_end(obj, &hold);
+    return CY_RSLT_SUCCESS;
 }
 
 
@@ -741,6 +1183,8 @@ cy_rslt_t mtb_hal_uart_write(mtb_hal_uart_t* obj, void* tx, size_t* tx_length)
     #endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
 
     *tx_length = Cy_SCB_UART_PutArray(obj->base, tx, *tx_length);
+    _MTB_HAL_PERF_ADD(obj, transfers, 1U);
+    _MTB_HAL_PERF_ADD(obj, bytes, *tx_length);
     return CY_RSLT_SUCCESS;
 }
 
@@ -767,6 +1211,8 @@ cy_rslt_t mtb_hal_uart_read(mtb_hal_uart_t* obj, void* rx, size_t* rx_length)
     #endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
 
     *rx_length = Cy_SCB_UART_GetArray(obj->base, rx, *rx_length);
+    _MTB_HAL_PERF_ADD(obj, transfers, 1U);
+    _MTB_HAL_PERF_ADD(obj, bytes, *rx_length);
     return CY_RSLT_SUCCESS;
 }
 
@@ -816,7 +1262,9 @@ void mtb_hal_uart_register_callback(mtb_hal_uart_t* obj, mtb_hal_uart_event_call
     obj->callback_data.callback = (cy_israddress)callback;
     obj->callback_data.callback_arg = callback_arg;
     mtb_hal_system_critical_section_exit(savedIntrStatus);
-    Cy_SCB_UART_RegisterCallback(obj->base, _mtb_hal_uart_cb_wrapper, obj->context);
+    Cy_SCB_UART_RegisterCallback(obj->base,
+                                 _mtb_hal_scb_bind_event(obj->base, obj, _mtb_hal_uart_cb_wrapper),
+                                 obj->context);
 }
 
 
@@ -892,6 +1340,11 @@ void mtb_hal_uart_enable_event(mtb_hal_uart_t* obj, mtb_hal_uart_event_t event,
     {
         obj->irq_cause &= ~event;
     }
+    if (obj->raw.active)
+    {
+        /* Raw FIFO mode owns the interrupt masks; only the delivered events change */
+        return;
+    }
     if (event == MTB_HAL_UART_IRQ_NONE)
     {
         /* "No interrupt" is equivalent for both "enable" and "disable" */
@@ -939,6 +1392,11 @@ void mtb_hal_uart_enable_event(mtb_hal_uart_t* obj, mtb_hal_uart_event_t event,
 cy_rslt_t mtb_hal_uart_process_interrupt(mtb_hal_uart_t* obj)
 {
     CY_ASSERT(NULL != obj);
+    if (obj->raw.active)
+    {
+        _mtb_hal_uart_raw_irq_handler(obj);
+        return CY_RSLT_SUCCESS;
+    }
     #if defined(COMPONENT_MW_ASYNC_TRANSFER)
     if (NULL != obj->async_handler)
     {
@@ -951,6 +1409,348 @@ cy_rslt_t mtb_hal_uart_process_interrupt(mtb_hal_uart_t* obj)
 }
 
 
+/** Start raw FIFO mode */
+cy_rslt_t mtb_hal_uart_raw_start(mtb_hal_uart_t* obj, uint8_t* rx_buffer, size_t rx_size,
+                                 uint8_t* tx_buffer, size_t tx_size)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->base);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != rx_buffer) && (0u != rx_size) &&
+                          (0u == (rx_size & (rx_size - 1u))) && (NULL != tx_buffer) &&
+                          (0u != tx_size) && (0u == (tx_size & (tx_size - 1u)))),
+                         MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT);
+    CY_ASSERT_AND_RETURN((!obj->raw.active && !_mtb_hal_uart_is_busy(obj)),
+                         MTB_HAL_UART_RSLT_ERR_BUSY);
+    #else
+    if ((NULL == rx_buffer) || (0u == rx_size) || (0u != (rx_size & (rx_size - 1u))) ||
+        (NULL == tx_buffer) || (0u == tx_size) || (0u != (tx_size & (tx_size - 1u))))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if (obj->raw.active || _mtb_hal_uart_is_busy(obj))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BUSY;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+    #if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+    if (NULL != obj->rx_ring.dma)
+    {
+        return MTB_HAL_UART_RSLT_ERR_BUSY;
+    }
+    #endif // (MTB_HAL_DRIVER_AVAILABLE_DMA)
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    memset(&obj->raw, 0, sizeof(obj->raw));
+    obj->raw.rx_buffer = rx_buffer;
+    obj->raw.rx_mask   = (uint32_t)rx_size - 1u;
+    obj->raw.tx_buffer = tx_buffer;
+    obj->raw.tx_mask   = (uint32_t)tx_size - 1u;
+    obj->raw.rx_level  = _mtb_hal_uart_get_rx_fifo_level(obj->base);
+    obj->raw.tx_level  = _mtb_hal_uart_get_tx_fifo_level(obj->base);
+
+    Cy_SCB_SetTxInterruptMask(obj->base, 0UL);
+    Cy_SCB_SetRxInterruptMask(obj->base, 0UL);
+    /* Interrupt on the first received byte; each pass drains everything that has accumulated */
+    Cy_SCB_SetRxFifoLevel(obj->base, 0UL);
+    Cy_SCB_SetTxFifoLevel(obj->base, Cy_SCB_GetFifoSize(obj->base) / 2UL);
+    Cy_SCB_ClearRxInterrupt(obj->base, CY_SCB_RX_INTR_MASK);
+    Cy_SCB_ClearTxInterrupt(obj->base, CY_SCB_TX_INTR_MASK);
+    obj->raw.active = true;
+    Cy_SCB_SetRxInterruptMask(obj->base, CY_SCB_RX_INTR_LEVEL | CY_SCB_UART_RECEIVE_ERR);
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return CY_RSLT_SUCCESS;
+}
+
+
+/** Stop raw FIFO mode */
+cy_rslt_t mtb_hal_uart_raw_stop(mtb_hal_uart_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->base);
+
+    if (obj->raw.active)
+    {
+        uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+        obj->raw.active = false;
+        Cy_SCB_SetTxInterruptMask(obj->base, 0UL);
+        Cy_SCB_SetRxInterruptMask(obj->base, 0UL);
+        Cy_SCB_SetRxFifoLevel(obj->base, obj->raw.rx_level);
+        Cy_SCB_SetTxFifoLevel(obj->base, obj->raw.tx_level);
+        mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+        /* Restore the interrupt masks of the events enabled by the application */
+        if (MTB_HAL_UART_IRQ_NONE != obj->irq_cause)
+        {
+            mtb_hal_uart_enable_event(obj, (mtb_hal_uart_event_t)obj->irq_cause, true);
+        }
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+/** Queue data for transmission in raw FIFO mode */
+cy_rslt_t mtb_hal_uart_raw_write(mtb_hal_uart_t* obj, const void* tx, size_t* tx_length)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != tx);
+    CY_ASSERT(NULL != tx_length);
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(obj->raw.active, MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION);
+    #else
+    if (!obj->raw.active)
+    {
+        return MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+
+    _mtb_hal_uart_raw_t* raw = &obj->raw;
+    const uint8_t* data = (const uint8_t*)tx;
+    uint32_t head = raw->tx_head;
+    uint32_t space = (raw->tx_mask + 1u) - (head - raw->tx_tail);
+    uint32_t count = ((uint32_t)*tx_length < space) ? (uint32_t)*tx_length : space;
+
+    for (uint32_t i = 0u; i < count; ++i)
+    {
+        raw->tx_buffer[head & raw->tx_mask] = data[i];
+        ++head;
+    }
+    *tx_length = count;
+
+    if (0u != count)
+    {
+        uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+        raw->tx_head = head;
+        Cy_SCB_SetTxInterruptMask(obj->base,
+                                  Cy_SCB_GetTxInterruptMask(obj->base) | CY_SCB_TX_INTR_LEVEL);
+        mtb_hal_system_critical_section_exit(savedIntrStatus);
+        _MTB_HAL_PERF_ADD(obj, transfers, 1U);
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+/** Read received data in raw FIFO mode */
+cy_rslt_t mtb_hal_uart_raw_read(mtb_hal_uart_t* obj, void* rx, size_t* rx_length)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != rx);
+    CY_ASSERT(NULL != rx_length);
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(obj->raw.active, MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION);
+    #else
+    if (!obj->raw.active)
+    {
+        return MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+
+    _mtb_hal_uart_raw_t* raw = &obj->raw;
+    uint8_t* data = (uint8_t*)rx;
+    uint32_t tail = raw->rx_tail;
+    uint32_t available = raw->rx_head - tail;
+    uint32_t count = ((uint32_t)*rx_length < available) ? (uint32_t)*rx_length : available;
+
+    for (uint32_t i = 0u; i < count; ++i)
+    {
+        data[i] = raw->rx_buffer[tail & raw->rx_mask];
+        ++tail;
+    }
+    /* Publish the new tail only after the data has been copied out */
+    __DMB();
+    raw->rx_tail = tail;
+    *rx_length = count;
+    return CY_RSLT_SUCCESS;
+}
+
+
+/** Get the number of unread bytes in the raw mode receive ring */
+uint32_t mtb_hal_uart_raw_readable(mtb_hal_uart_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->raw.rx_head - obj->raw.rx_tail;
+}
+
+
+#if (MTB_HAL_DRIVER_AVAILABLE_DMA)
+/** Start continuous DMA reception into a ring buffer */
+cy_rslt_t mtb_hal_uart_rx_ring_start(mtb_hal_uart_t* obj, mtb_hal_dma_t* dma_rx, uint8_t* buffer,
+                                     size_t size)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->base);
+    CY_ASSERT(NULL != dma_rx);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL != buffer) && (0u != size) && (0u == (size & (size - 1u)))),
+                         MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT);
+    CY_ASSERT_AND_RETURN((NULL == obj->rx_ring.dma), MTB_HAL_UART_RSLT_ERR_BUSY);
+    #else
+    if ((NULL == buffer) || (0u == size) || (0u != (size & (size - 1u))))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if (NULL != obj->rx_ring.dma)
+    {
+        return MTB_HAL_UART_RSLT_ERR_BUSY;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+    #if defined(COMPONENT_MW_ASYNC_TRANSFER)
+    /* Return busy if an async read operation is in progress */
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN(((NULL == obj->async_ctx) || mtb_hal_uart_is_async_rx_available(
+                              obj)), MTB_HAL_UART_RSLT_ERR_BUSY);
+    #else
+    if ((NULL != obj->async_ctx) && (!mtb_hal_uart_is_async_rx_available(obj)))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BUSY;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+    #endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
+
+    memset(&obj->rx_ring, 0, sizeof(obj->rx_ring));
+    obj->rx_ring.buffer = buffer;
+    obj->rx_ring.size   = (uint32_t)size;
+    /* Restored by mtb_hal_uart_rx_ring_stop for the async transfers that share the channel */
+    obj->rx_ring.rx_level = _mtb_hal_uart_get_rx_fifo_level(obj->base);
+    obj->rx_ring.dma_callback = dma_rx->callback_data;
+    obj->rx_ring.dma_bursts = dma_rx->expected_bursts;
+    obj->rx_ring.dma_events = dma_rx->irq_cause;
+
+    cy_rslt_t result = mtb_hal_dma_disable(dma_rx);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        _mtb_hal_dma_save_descriptor(dma_rx, &(obj->rx_ring.dma_descr));
+        result = mtb_hal_dma_set_transfer(dma_rx, (uint32_t)&((obj->base)->RX_FIFO_RD),
+                                          (uint32_t)buffer, (uint32_t)size, false);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = mtb_hal_dma_set_circular(dma_rx, true);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_InvalidateDCache_by_Addr((void*)buffer, (int32_t)size);
+        #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+
+        obj->rx_ring.dma = dma_rx;
+        mtb_hal_dma_register_callback(dma_rx, _mtb_hal_uart_rx_ring_dma_event_callback, obj);
+        mtb_hal_dma_enable_event(dma_rx,
+                                 (mtb_hal_dma_event_t)(MTB_HAL_DMA_TRANSFER_COMPLETE |
+                                                       MTB_HAL_DMA_DESCRIPTOR_COMPLETE), true);
+        /* Request a DMA transfer as soon as one byte is in the RX FIFO */
+        Cy_SCB_SetRxFifoLevel(obj->base, 0u);
+        result = mtb_hal_dma_enable(dma_rx);
+    }
+    return result;
+}
+
+
+/** Stop continuous DMA reception */
+cy_rslt_t mtb_hal_uart_rx_ring_stop(mtb_hal_uart_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    mtb_hal_dma_t* dma_rx = obj->rx_ring.dma;
+
+    if (NULL != dma_rx)
+    {
+        result = mtb_hal_dma_disable(dma_rx);
+        /* Give the channel back with the chaining and events it had before the ring */
+        mtb_hal_dma_enable_event(dma_rx, (mtb_hal_dma_event_t)dma_rx->irq_cause, false);
+        mtb_hal_dma_enable_event(dma_rx, (mtb_hal_dma_event_t)obj->rx_ring.dma_events, true);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            _mtb_hal_dma_restore_descriptor(dma_rx, &(obj->rx_ring.dma_descr));
+            dma_rx->expected_bursts = obj->rx_ring.dma_bursts;
+        }
+        _mtb_hal_event_callback_data_t* saved = &(obj->rx_ring.dma_callback);
+        mtb_hal_dma_register_callback(dma_rx, (mtb_hal_dma_event_callback_t)saved->callback,
+                                      saved->callback_arg);
+        Cy_SCB_SetRxFifoLevel(obj->base, obj->rx_ring.rx_level);
+        obj->rx_ring.dma = NULL;
+    }
+    return result;
+}
+
+
+/** Get the number of unread bytes in the RX ring */
+uint32_t mtb_hal_uart_rx_ring_readable(mtb_hal_uart_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->rx_ring.dma);
+    uint32_t available = _mtb_hal_uart_rx_ring_get_head(obj) - obj->rx_ring.tail;
+    return _MTB_HAL_MIN(available, obj->rx_ring.size);
+}
+
+
+/** Get the oldest contiguous span of unread data in the RX ring */
+size_t mtb_hal_uart_rx_ring_get_span(mtb_hal_uart_t* obj, uint8_t** data)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != data);
+    CY_ASSERT(NULL != obj->rx_ring.dma);
+
+    uint32_t available = mtb_hal_uart_rx_ring_readable(obj);
+    uint32_t offset    = obj->rx_ring.tail & (obj->rx_ring.size - 1u);
+    uint32_t span      = _MTB_HAL_MIN(available, obj->rx_ring.size - offset);
+
+    *data = &obj->rx_ring.buffer[offset];
+    #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    if (span > 0u)
+    {
+        SCB_InvalidateDCache_by_Addr((void*)*data, (int32_t)span);
+    }
+    #endif /* defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) */
+    return span;
+}
+
+
+/** Release consumed bytes from the RX ring */
+void mtb_hal_uart_rx_ring_release(mtb_hal_uart_t* obj, size_t length)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->rx_ring.dma);
+    /* The DMA interrupt may move the read index on overflow */
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    /* Releasing more than is readable would move the read index past the write index */
+    uint32_t readable = mtb_hal_uart_rx_ring_readable(obj);
+    CY_ASSERT(length <= readable);
+    obj->rx_ring.tail += _MTB_HAL_MIN((uint32_t)length, readable);
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+}
+
+
+/** Check the receive line for idleness */
+bool mtb_hal_uart_rx_ring_check_idle(mtb_hal_uart_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->rx_ring.dma);
+    bool idle = false;
+    uint32_t head = _mtb_hal_uart_rx_ring_get_head(obj);
+
+    if (head != obj->rx_ring.idle_head)
+    {
+        obj->rx_ring.idle_head = head;
+        obj->rx_ring.idle_reported = false;
+    }
+    else if (head != obj->rx_ring.tail)
+    {
+        idle = true;
+        if (!obj->rx_ring.idle_reported)
+        {
+            obj->rx_ring.idle_reported = true;
+            _mtb_hal_uart_rx_ring_notify(obj, MTB_HAL_UART_IRQ_RX_IDLE);
+        }
+    }
+    return idle;
+}
+
+
+#endif /* (MTB_HAL_DRIVER_AVAILABLE_DMA) */
+
 #if defined(COMPONENT_MW_ASYNC_TRANSFER)
 /**Configure the UART async transfer interface */
 cy_rslt_t mtb_hal_uart_config_async(mtb_hal_uart_t* obj, mtb_async_transfer_context_t* context)
@@ -989,11 +1789,13 @@ cy_rslt_t mtb_hal_uart_config_async_dma(mtb_hal_uart_t* obj, mtb_hal_dma_t* dma_
     {
         interface.dma_rx_ref = dma_rx;
         interface.dma_tx_ref = dma_tx;
-        interface.dma_set_length = (mtb_async_transfer_dma_set_len_t)mtb_hal_dma_set_length;
+        interface.dma_set_length = (mtb_async_transfer_dma_set_len_t)_mtb_hal_uart_dma_set_length;
         interface.dma_set_src = _mtb_hal_uart_dma_set_src_addr;
         interface.dma_set_dest = _mtb_hal_uart_dma_set_dst_addr;
         interface.dma_enable_rx = _mtb_hal_uart_async_transfer_enable_dma;
         interface.dma_enable_tx = _mtb_hal_uart_async_transfer_enable_dma;
+        /* The DMA is triggered by the FIFO level, so the level must match its burst size */
+        obj->fifo_adapt.dma = true;
         if (NULL != dma_rx)
         {
             mtb_hal_dma_register_callback(dma_rx, _mtb_hal_uart_rx_dma_event_callback, obj);
@@ -1094,6 +1896,124 @@ cy_rslt_t mtb_hal_uart_write_abort(mtb_hal_uart_t* obj)
 }
 
 
+/** Enable or disable adaptive RX/TX FIFO trigger levels for async transfers */
+cy_rslt_t mtb_hal_uart_enable_adaptive_fifo(mtb_hal_uart_t* obj, bool enable)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->base);
+    CY_ASSERT(NULL != obj->async_ctx);
+
+    #if defined(MTB_HAL_DISABLE_ERR_CHECK)
+    CY_ASSERT_AND_RETURN((!enable || !obj->fifo_adapt.dma),
+                         MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION);
+    CY_ASSERT_AND_RETURN((mtb_hal_uart_is_async_rx_available(obj) &&
+                          mtb_hal_uart_is_async_tx_available(obj)), MTB_HAL_UART_RSLT_ERR_BUSY);
+    #else
+    if (enable && obj->fifo_adapt.dma)
+    {
+        return MTB_HAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+    if (!mtb_hal_uart_is_async_rx_available(obj) || !mtb_hal_uart_is_async_tx_available(obj))
+    {
+        return MTB_HAL_UART_RSLT_ERR_BUSY;
+    }
+    #endif // defined(MTB_HAL_DISABLE_ERR_CHECK)
+
+    uint32_t fifo_size = Cy_SCB_GetFifoSize(obj->base);
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    obj->fifo_adapt.enabled = enable;
+    /* Start from the levels the async transfer library would use and tune from there */
+    obj->fifo_adapt.rx_level =
+        (uint16_t)(_mtb_hal_uart_async_transfer_get_rx_transfer_len(obj) - 1u);
+    obj->fifo_adapt.tx_level = (uint16_t)(fifo_size / 2u);
+    obj->fifo_adapt.rx_last_count = 0u;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+    return CY_RSLT_SUCCESS;
+}
+
+
+/** Release data held in the RX FIFO below the trigger level */
+bool mtb_hal_uart_check_rx_timeout(mtb_hal_uart_t* obj)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != obj->base);
+
+    _mtb_hal_uart_fifo_adapt_t* adapt = &obj->fifo_adapt;
+    bool timed_out = false;
+
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    uint32_t count = Cy_SCB_UART_GetNumInRxFifo(obj->base);
+    /* A read in progress with data below its trigger level and no arrival for a full period */
+    if (adapt->enabled && !mtb_hal_uart_is_async_rx_available(obj) && (0u != count) &&
+        (count <= adapt->rx_applied) && (count == adapt->rx_last_count))
+    {
+        timed_out = true;
+        ++adapt->rx_timeouts;
+        adapt->rx_timeout_bytes += count;
+        if (adapt->rx_level > 0u)
+        {
+            adapt->rx_level /= 2u;
+            ++adapt->level_changes;
+        }
+        /* Drop the level below the FIFO count so the level interrupt delivers the data now. The
+           async transfer library reprograms the level when it services the interrupt. */
+        adapt->rx_applied = (uint16_t)(count - 1u);
+        Cy_SCB_SetRxFifoLevel(obj->base, adapt->rx_applied);
+        count = 0u;
+    }
+    adapt->rx_last_count = (uint16_t)count;
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    if (timed_out && (0u != (obj->irq_cause & MTB_HAL_UART_IRQ_RX_TIMEOUT)))
+    {
+        mtb_hal_uart_event_callback_t callback =
+            (mtb_hal_uart_event_callback_t)obj->callback_data.callback;
+        if (NULL != callback)
+        {
+            callback(obj->callback_data.callback_arg, MTB_HAL_UART_IRQ_RX_TIMEOUT);
+        }
+    }
+    return timed_out;
+}
+
+
+/** Get the adaptive FIFO trigger level statistics */
+void mtb_hal_uart_get_fifo_stats(mtb_hal_uart_t* obj, mtb_hal_uart_fifo_stats_t* stats,
+                                 bool reset)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != stats);
+
+    _mtb_hal_uart_fifo_adapt_t* adapt = &obj->fifo_adapt;
+    uint32_t savedIntrStatus = mtb_hal_system_critical_section_enter();
+    stats->rx_bytes = adapt->rx_bytes;
+    stats->rx_interrupts = adapt->rx_interrupts;
+    stats->tx_bytes = adapt->tx_bytes;
+    stats->tx_interrupts = adapt->tx_interrupts;
+    stats->tx_underruns = adapt->tx_underruns;
+    stats->rx_timeouts = adapt->rx_timeouts;
+    stats->rx_timeout_bytes = adapt->rx_timeout_bytes;
+    stats->level_changes = adapt->level_changes;
+    if (reset)
+    {
+        adapt->rx_bytes = 0u;
+        adapt->rx_interrupts = 0u;
+        adapt->tx_bytes = 0u;
+        adapt->tx_interrupts = 0u;
+        adapt->tx_underruns = 0u;
+        adapt->rx_timeouts = 0u;
+        adapt->rx_timeout_bytes = 0u;
+        adapt->level_changes = 0u;
+    }
+    mtb_hal_system_critical_section_exit(savedIntrStatus);
+
+    stats->rx_interrupts_per_kib = (0u != stats->rx_bytes)
+        ? (uint32_t)(((uint64_t)stats->rx_interrupts * 1024u) / stats->rx_bytes) : 0u;
+    stats->tx_interrupts_per_kib = (0u != stats->tx_bytes)
+        ? (uint32_t)(((uint64_t)stats->tx_interrupts * 1024u) / stats->tx_bytes) : 0u;
+}
+
+
 #endif // defined(COMPONENT_MW_ASYNC_TRANSFER)
 
 #if defined(__cplusplus)
@@ -48,7 +48,8 @@ int32_t _mtb_hal_utils_calculate_tolerance(mtb_hal_clock_tolerance_unit_t type,
             return (int32_t)(desired_hz - actual_hz);
 
         case MTB_HAL_TOLERANCE_PPM:
-            return (int32_t)(((int64_t)(desired_hz - actual_hz)) * 1000000) / ((int32_t)desired_hz);
+            return (int32_t)((((int64_t)desired_hz - (int64_t)actual_hz) * 1000000) /
+                             (int64_t)desired_hz);
 
         case MTB_HAL_TOLERANCE_PERCENT:
             return (int32_t)((((int64_t)desired_hz - actual_hz) * 100) / desired_hz);
@@ -71,6 +72,9 @@ cy_rslt_t _mtb_hal_wait_for_status(void* obj, uint32_t status, uint32_t* timeout
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     uint32_t timeout_us = _MTB_HAL_UTILS_US_PER_MS;
+    #if defined(MTB_HAL_PERF_ENABLE)
+    uint32_t polled_us = 0U;
+    #endif // defined(MTB_HAL_PERF_ENABLE)
 
     if (*timeout > 0)
     {
@@ -80,6 +84,9 @@ cy_rslt_t _mtb_hal_wait_for_status(void* obj, uint32_t status, uint32_t* timeout
             {
                 mtb_hal_system_delay_us(_MTB_HAL_UTILS_ONE_TIME_UNIT);
                 --timeout_us;
+                #if defined(MTB_HAL_PERF_ENABLE)
+                ++polled_us;
+                #endif // defined(MTB_HAL_PERF_ENABLE)
             }
             else
             {
@@ -88,6 +95,8 @@ cy_rslt_t _mtb_hal_wait_for_status(void* obj, uint32_t status, uint32_t* timeout
             }
         }
         result = (*timeout > 0) ? CY_RSLT_SUCCESS : (cy_rslt_t)(-1);
+        /* The caller is not known here; the trace entry identifies it by its object */
+        _MTB_HAL_PERF_TRACE(MTB_HAL_RSLT_MODULE_SYSTEM, MTB_HAL_PERF_EVENT_WAIT, obj, polled_us);
     }
     return result;
 }